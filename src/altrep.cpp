@@ -18,12 +18,24 @@
 #include "./arrow_types.h"
 
 #include <arrow/array.h>
+#include <arrow/array/statistics.h>
 #include <arrow/chunk_resolver.h>
 #include <arrow/chunked_array.h>
 #include <arrow/compute/api.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/ipc/writer.h>
+#include <arrow/record_batch.h>
+#include <arrow/table.h>
 #include <arrow/util/bitmap_reader.h>
 #include <arrow/visit_data_inline.h>
 
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <variant>
+
 #include <cpp11/declarations.hpp>
 
 #include <R_ext/Altrep.h>
@@ -35,6 +47,10 @@ SEXP Array__as_vector(const std::shared_ptr<arrow::Array>& array);
 
 namespace arrow {
 namespace r {
+
+// defined in array_to_vector.cpp
+bool ArraysCanFitInteger(ArrayVector arrays);
+
 namespace altrep {
 
 namespace {
@@ -62,25 +78,289 @@ using Pointer = cpp11::external_pointer<std::shared_ptr<T>, DeletePointer<T>>;
 using ChunkResolver = arrow::ChunkResolver;
 using ChunkLocation = arrow::ChunkLocation;
 
+// Follows the values and nulls of a vector, in order, to find out whether it
+// is sorted in the sense of the ALTREP Is_sorted method: in increasing or
+// decreasing order (not strictly), with all the NA either first or last.
+class SortednessChecker {
+ public:
+  void Null() {
+    if (has_values_) {
+      trailing_nulls_ = true;
+    } else {
+      leading_nulls_ = true;
+    }
+  }
+
+  void Value(double value) {
+    if (std::isnan(value)) {
+      // R sorts NaN with NA, let R figure it out
+      has_nan_ = true;
+      return;
+    }
+
+    if (trailing_nulls_) {
+      // NA in the middle of the values
+      increasing_ = decreasing_ = false;
+      return;
+    }
+
+    if (has_values_) {
+      increasing_ = increasing_ && last_ <= value;
+      decreasing_ = decreasing_ && last_ >= value;
+    }
+    has_values_ = true;
+    last_ = value;
+  }
+
+  // the remaining values can't change the result
+  bool done() const { return has_nan_ || !(increasing_ || decreasing_); }
+
+  int result() const {
+    if (has_nan_ || !has_values_) {
+      return UNKNOWN_SORTEDNESS;
+    }
+    if (!(increasing_ || decreasing_) || (leading_nulls_ && trailing_nulls_)) {
+      return KNOWN_UNSORTED;
+    }
+    if (increasing_) {
+      return leading_nulls_ ? SORTED_INCR_NA_1ST : SORTED_INCR;
+    }
+    return leading_nulls_ ? SORTED_DECR_NA_1ST : SORTED_DECR;
+  }
+
+ private:
+  bool has_values_ = false;
+  bool leading_nulls_ = false;
+  bool trailing_nulls_ = false;
+  bool has_nan_ = false;
+  bool increasing_ = true;
+  bool decreasing_ = true;
+  double last_ = 0;
+};
+
+// The exact range of the values of the array, as R sees them, if the array
+// carries statistics, e.g. when read from Parquet with load_statistics.
+template <typename c_type, typename Convert>
+std::optional<std::pair<double, double>> StatisticsRange(const Array& array,
+                                                         Convert&& convert) {
+  const auto& statistics = array.statistics();
+  if (statistics == nullptr || !statistics->min.has_value() ||
+      !statistics->max.has_value() || !statistics->is_min_exact ||
+      !statistics->is_max_exact) {
+    return std::nullopt;
+  }
+
+  auto value = [&](const ArrayStatistics::ValueType& stat) -> std::optional<double> {
+    if (const auto* int_value = std::get_if<int64_t>(&stat)) {
+      return convert(static_cast<c_type>(*int_value));
+    }
+    if (const auto* double_value = std::get_if<double>(&stat)) {
+      return convert(static_cast<c_type>(*double_value));
+    }
+    return std::nullopt;
+  };
+
+  auto min = value(*statistics->min);
+  auto max = value(*statistics->max);
+  if (!min.has_value() || !max.has_value()) {
+    return std::nullopt;
+  }
+  return std::make_pair(*min, *max);
+}
+
+// Sortedness of the R vector made of the values of `chunked_array`, after
+// `convert`. Chunk statistics, when present, are used to skip the scan: to
+// rule out sorting altogether when the ranges of the chunks go both up and
+// down, and to skip over chunks that only have one distinct value.
+//
+// The statistics of a chunk may be those of a larger piece of data, e.g. all
+// the batches read from a Parquet row group carry the statistics of the row
+// group, so their ranges only bound the values of the chunk. Equal or
+// overlapping ranges therefore say nothing, and only ranges that are strictly
+// apart are compared.
+template <typename ArrowType, typename Convert>
+int ComputeSortedness(const ChunkedArray& chunked_array, Convert&& convert) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename TypeTraits<ArrowType>::CType;
+
+  SortednessChecker checker;
+  std::optional<std::pair<double, double>> previous_range;
+  bool ranges_go_up = false;
+  bool ranges_go_down = false;
+  for (const auto& chunk : chunked_array.chunks()) {
+    auto range = StatisticsRange<c_type>(*chunk, convert);
+    if (range.has_value()) {
+      if (previous_range.has_value()) {
+        ranges_go_up |= previous_range->second < range->first;
+        ranges_go_down |= previous_range->first > range->second;
+        if (ranges_go_up && ranges_go_down) {
+          return KNOWN_UNSORTED;
+        }
+      }
+      previous_range = range;
+
+      // min and max ignore NaN, so this only holds for integer-like values
+      if (!is_floating_type<ArrowType>::value && chunk->null_count() == 0 &&
+          range->first == range->second) {
+        checker.Value(range->first);
+        continue;
+      }
+    }
+
+    const auto& array = internal::checked_cast<const ArrayType&>(*chunk);
+    for (int64_t i = 0; i < array.length() && !checker.done(); i++) {
+      if (array.IsNull(i)) {
+        checker.Null();
+      } else {
+        checker.Value(convert(array.Value(i)));
+      }
+    }
+    if (checker.done()) {
+      break;
+    }
+  }
+
+  return checker.result();
+}
+
 class ArrowAltrepData {
  public:
   explicit ArrowAltrepData(const std::shared_ptr<ChunkedArray>& chunked_array)
-      : chunked_array_(chunked_array), resolver_(chunked_array->chunks()) {}
+      : chunked_array_(chunked_array), resolver_(chunked_array->chunks()) {
+    if (resolver_.num_chunks() > 0) {
+      cursor_end_ = resolver_.chunk_length(0);
+    }
+  }
 
   const std::shared_ptr<ChunkedArray>& chunked_array() { return chunked_array_; }
 
-  ChunkLocation locate(int64_t index) { return resolver_.Resolve(index); }
+  // Find the chunk of the value at `index`. R often goes through the vector in
+  // order, e.g. in for loops or vapply(), so the chunk of the previous call
+  // and the ones right after it are checked before doing a binary search.
+  ChunkLocation locate(int64_t index) {
+    if (index >= cursor_begin_) {
+      for (int step = 0; step < kCursorSteps; step++) {
+        if (index < cursor_end_) {
+          return ChunkLocation{cursor_chunk_, index - cursor_begin_};
+        }
+        if (cursor_chunk_ + 1 >= resolver_.num_chunks()) {
+          break;
+        }
+        cursor_chunk_++;
+        cursor_begin_ = cursor_end_;
+        cursor_end_ += resolver_.chunk_length(cursor_chunk_);
+      }
+    }
+
+    auto location = resolver_.Resolve(index);
+    if (location.chunk_index < static_cast<int64_t>(resolver_.num_chunks())) {
+      cursor_chunk_ = location.chunk_index;
+      cursor_begin_ = index - location.index_in_chunk;
+      cursor_end_ = cursor_begin_ + resolver_.chunk_length(cursor_chunk_);
+    }
+    return location;
+  }
+
+  // Call `visit(chunk_index, array, offset, length)` for each of the chunks
+  // holding the values from position `i` to `i + n`, in order, and return the
+  // number of values, which is less than `n` at the end of the vector.
+  template <typename Visit>
+  int64_t VisitRegion(int64_t i, int64_t n, Visit&& visit) {
+    auto length = chunked_array_->length();
+    if (i >= length) {
+      return 0;
+    }
+    n = std::min(n, length - i);
+
+    auto location = locate(i);
+    auto chunk_index = static_cast<int>(location.chunk_index);
+    auto offset = location.index_in_chunk;
+    for (int64_t remaining = n; remaining > 0; chunk_index++, offset = 0) {
+      const auto& array = chunked_array_->chunk(chunk_index);
+      auto count = std::min(array->length() - offset, remaining);
+      if (count > 0) {
+        visit(chunk_index, array, offset, count);
+        remaining -= count;
+      }
+    }
+
+    return n;
+  }
+
+  // Sortedness of the values, after `convert`, computed the first time R asks
+  template <typename ArrowType, typename Convert>
+  int sortedness(Convert&& convert) {
+    if (!sortedness_.has_value()) {
+      sortedness_ = ComputeSortedness<ArrowType>(*chunked_array_, convert);
+    }
+    return *sortedness_;
+  }
+
+  // Whether a floating point array has NaN values, which R counts as NA
+  template <typename ArrowType>
+  bool has_nan() {
+    using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+    if (!has_nan_.has_value()) {
+      has_nan_ = false;
+      for (const auto& chunk : chunked_array_->chunks()) {
+        const auto& array = internal::checked_cast<const ArrayType&>(*chunk);
+        for (int64_t i = 0; i < array.length(); i++) {
+          if (array.IsValid(i) && std::isnan(array.Value(i))) {
+            has_nan_ = true;
+            return true;
+          }
+        }
+      }
+    }
+    return *has_nan_;
+  }
 
  private:
+  // how many chunks locate() moves forward before doing a binary search,
+  // more than one to go over empty chunks
+  static constexpr int kCursorSteps = 4;
+
   std::shared_ptr<ChunkedArray> chunked_array_;
   ChunkResolver resolver_;
+
+  // the chunk found by the last call to locate(), and its [begin, end) range
+  int64_t cursor_chunk_ = 0;
+  int64_t cursor_begin_ = 0;
+  int64_t cursor_end_ = 0;
+
+  std::optional<int> sortedness_;
+  std::optional<bool> has_nan_;
 };
 
+// The ChunkedArray as an IPC stream of single column record batches, one per chunk
+Status WriteChunkedArrayStream(const ChunkedArray& chunked_array,
+                               io::OutputStream* sink) {
+  auto schema = arrow::schema({field("", chunked_array.type())});
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeStreamWriter(sink, schema));
+  for (const auto& chunk : chunked_array.chunks()) {
+    ARROW_RETURN_NOT_OK(
+        writer->WriteRecordBatch(*RecordBatch::Make(schema, chunk->length(), {chunk})));
+  }
+  return writer->Close();
+}
+
+// Read back the output of WriteChunkedArrayStream() from a raw vector. The
+// arrays point into the raw vector, which they keep alive.
+std::shared_ptr<ChunkedArray> ReadChunkedArrayStream(SEXP raw) {
+  io::BufferReader input(std::make_shared<RBuffer<cpp11::raws>>(cpp11::raws(raw)));
+  auto reader = ValueOrStop(ipc::RecordBatchStreamReader::Open(&input));
+  auto table = ValueOrStop(reader->ToTable());
+  return table->column(0);
+}
+
+ArrowAltrepData* GetAltrepData(SEXP alt) {
+  return reinterpret_cast<ArrowAltrepData*>(R_ExternalPtrAddr(R_altrep_data1(alt)));
+}
+
 // the ChunkedArray that is being wrapped by the altrep object
 const std::shared_ptr<ChunkedArray>& GetChunkedArray(SEXP alt) {
-  auto array_data =
-      reinterpret_cast<ArrowAltrepData*>(R_ExternalPtrAddr(R_altrep_data1(alt)));
-  return array_data->chunked_array();
+  return GetAltrepData(alt)->chunked_array();
 }
 
 // base class for all altrep vectors
@@ -120,10 +400,21 @@ struct AltrepVectorBase {
       return false;
     }
 
-    return GetChunkedArray(alt)->null_count() == 0;
+    return GetChunkedArray(alt)->null_count() == 0 && !Impl::HasNaN(alt);
+  }
+
+  static int Is_sorted(SEXP alt) {
+    if (IsMaterialized(alt)) {
+      return UNKNOWN_SORTEDNESS;
+    }
+
+    return Impl::Sortedness(alt);
   }
 
-  static int Is_sorted(SEXP alt) { return UNKNOWN_SORTEDNESS; }
+  // defaults for No_NA() and Is_sorted(), overridden by the vectors of numbers
+  static bool HasNaN(SEXP alt) { return false; }
+
+  static int Sortedness(SEXP alt) { return UNKNOWN_SORTEDNESS; }
 
   // What gets printed on .Internal(inspect(<the altrep object>))
   static Rboolean Inspect(SEXP alt, int pre, int deep, int pvec,
@@ -155,9 +446,40 @@ struct AltrepVectorBase {
     return Rf_coerceVector(Impl::Materialize(alt), type);
   }
 
-  static SEXP Serialized_state(SEXP alt) { return Impl::Materialize(alt); }
+  // The state is the ChunkedArray as an IPC stream in a raw vector, so that
+  // serialize() does not need to materialize the vector, or the materialized
+  // vector if there is one already.
+  static SEXP Serialized_state(SEXP alt) {
+    if (IsMaterialized(alt)) {
+      return Impl::Representation(alt);
+    }
+
+    const auto& chunked_array = GetChunkedArray(alt);
+
+    // size the stream without writing it, then write it straight into the raw
+    // vector, so that it is never held anywhere else
+    io::MockOutputStream mock;
+    if (!WriteChunkedArrayStream(*chunked_array, &mock).ok()) {
+      return Impl::Materialize(alt);
+    }
+    int64_t size = mock.GetExtentBytesWritten();
 
-  static SEXP Unserialize(SEXP /* class_ */, SEXP state) { return state; }
+    cpp11::writable::raws state(static_cast<R_xlen_t>(size));
+    io::FixedSizeBufferWriter sink(std::make_shared<MutableBuffer>(RAW(state), size));
+    StopIfNotOk(WriteChunkedArrayStream(*chunked_array, &sink));
+
+    return state;
+  }
+
+  // Wrap the arrays read from the IPC stream, without copying them out of the
+  // raw vector. R sets the attributes afterwards.
+  static SEXP Unserialize(SEXP /* class_ */, SEXP state) {
+    if (TYPEOF(state) != RAWSXP) {
+      return state;
+    }
+
+    return Impl::Make(ReadChunkedArrayStream(state));
+  }
 
   // default methods used when data2 is the representation
   // this is overridden when data2 needs to be richer (e.g. for factors)
@@ -178,10 +500,25 @@ struct AltrepVectorPrimitive : public AltrepVectorBase<AltrepVectorPrimitive<sex
   static R_altrep_class_t class_t;
 
   using c_type = typename std::conditional<sexp_type == REALSXP, double, int>::type;
+  using ArrowType =
+      typename std::conditional<sexp_type == REALSXP, DoubleType, Int32Type>::type;
   using Base::IsMaterialized;
   using Base::Representation;
   using Base::SetRepresentation;
 
+  static bool HasNaN(SEXP alt) {
+    if constexpr (sexp_type == REALSXP) {
+      return GetAltrepData(alt)->template has_nan<ArrowType>();
+    } else {
+      return false;
+    }
+  }
+
+  static int Sortedness(SEXP alt) {
+    return GetAltrepData(alt)->template sortedness<ArrowType>(
+        [](c_type value) { return static_cast<double>(value); });
+  }
+
   // Force materialization. After calling this, the data2 slot of the altrep
   // object contains a standard R vector with the same data, with
   // R sentinels where the Array has nulls. This method also releases the
@@ -301,20 +638,17 @@ struct AltrepVectorPrimitive : public AltrepVectorBase<AltrepVectorPrimitive<sex
     // array has nulls
     //
     // This only materializes the region into buf (not the entire vector).
-    auto slice = GetChunkedArray(alt)->Slice(i, n);
-    R_xlen_t ncopy = slice->length();
-
     c_type* out = buf;
-    for (const auto& array : slice->chunks()) {
-      auto n_i = array->length();
-
+    auto visit = [&](int, const std::shared_ptr<Array>& array, int64_t offset,
+                     int64_t n_i) {
       // first copy the data buffer
-      memcpy(out, array->data()->template GetValues<c_type>(1), n_i * sizeof(c_type));
+      memcpy(out, array->data()->template GetValues<c_type>(1) + offset,
+             n_i * sizeof(c_type));
 
       // then set the R NA sentinels if needed
       if (array->null_count() > 0) {
         internal::BitmapReader bitmap_reader(array->null_bitmap()->data(),
-                                             array->offset(), n_i);
+                                             array->offset() + offset, n_i);
 
         for (R_xlen_t j = 0; j < n_i; j++, bitmap_reader.Next()) {
           if (bitmap_reader.IsNotSet()) {
@@ -324,9 +658,9 @@ struct AltrepVectorPrimitive : public AltrepVectorBase<AltrepVectorPrimitive<sex
       }
 
       out += n_i;
-    }
+    };
 
-    return ncopy;
+    return GetAltrepData(alt)->VisitRegion(i, n, visit);
   }
 
   static std::shared_ptr<arrow::compute::ScalarAggregateOptions> NaRmOptions(bool na_rm) {
@@ -417,6 +751,361 @@ struct AltrepVectorPrimitive : public AltrepVectorBase<AltrepVectorPrimitive<sex
 template <int sexp_type>
 R_altrep_class_t AltrepVectorPrimitive<sexp_type>::class_t;
 
+// Traits for the Arrow types whose values need converting before R can use
+// them, used by AltrepVectorConverted below.
+//
+// Value() converts a single non-null value, na() is what R uses for nulls,
+// SetAttributes() gives the R vector its class, and the has_* constants say
+// which of Sum()/Min()/Max() are computed by arrow instead of letting R
+// materialize the vector. `sortable` is set when R orders the vector by its
+// values, so that Is_sorted() can be answered from them.
+struct Float32Traits {
+  using ArrowType = FloatType;
+  using c_type = double;
+  static constexpr int sexp_type = REALSXP;
+  static constexpr bool has_sum = true;
+  static constexpr bool has_min_max = true;
+  static constexpr bool sortable = true;
+
+  explicit Float32Traits(const DataType&) {}
+  double Value(float value) const { return static_cast<double>(value); }
+  static double na() { return NA_REAL; }
+  static void SetAttributes(SEXP alt, const DataType&) {}
+};
+
+// int64 values that all fit in an int, i.e. the arrow.int64_downcast case
+struct Int64DowncastTraits {
+  using ArrowType = Int64Type;
+  using c_type = int;
+  static constexpr int sexp_type = INTSXP;
+  static constexpr bool has_sum = true;
+  static constexpr bool has_min_max = true;
+  static constexpr bool sortable = true;
+
+  explicit Int64DowncastTraits(const DataType&) {}
+  int Value(int64_t value) const { return static_cast<int>(value); }
+  static int na() { return NA_INTEGER; }
+  static void SetAttributes(SEXP alt, const DataType&) {}
+};
+
+// int64 values as bit64::integer64, i.e. the bits of the int64 stored in a
+// double. Summary functions dispatch to bit64 methods, which are not altrep aware.
+struct Integer64Traits {
+  using ArrowType = Int64Type;
+  using c_type = double;
+  static constexpr int sexp_type = REALSXP;
+  static constexpr bool has_sum = false;
+  static constexpr bool has_min_max = false;
+  static constexpr bool sortable = false;
+
+  explicit Integer64Traits(const DataType&) {}
+  double Value(int64_t value) const { return BitCast(value); }
+  static double na() { return BitCast(NA_INT64); }
+  static void SetAttributes(SEXP alt, const DataType&) {
+    Rf_classgets(alt, Rf_mkString("integer64"));
+  }
+
+ private:
+  static double BitCast(int64_t value) {
+    double out;
+    memcpy(&out, &value, sizeof(double));
+    return out;
+  }
+};
+
+struct BooleanTraits {
+  using ArrowType = BooleanType;
+  using c_type = int;
+  static constexpr int sexp_type = LGLSXP;
+  static constexpr bool has_sum = true;
+  static constexpr bool has_min_max = false;
+  static constexpr bool sortable = false;
+
+  explicit BooleanTraits(const DataType&) {}
+  int Value(bool value) const { return value; }
+  static int na() { return NA_LOGICAL; }
+  static void SetAttributes(SEXP alt, const DataType&) {}
+};
+
+// Date: number of days since the epoch, as a double
+struct Date32Traits {
+  using ArrowType = Date32Type;
+  using c_type = double;
+  static constexpr int sexp_type = REALSXP;
+  static constexpr bool has_sum = false;
+  static constexpr bool has_min_max = true;
+  static constexpr bool sortable = true;
+
+  explicit Date32Traits(const DataType&) {}
+  double Value(int32_t value) const { return static_cast<double>(value); }
+  static double na() { return NA_REAL; }
+  static void SetAttributes(SEXP alt, const DataType&) {
+    Rf_classgets(alt, Rf_mkString("Date"));
+  }
+};
+
+// POSIXct: number of seconds since the epoch, as a double. The scaling from
+// the TimeUnit of the array only happens when values are accessed.
+struct TimestampTraits {
+  using ArrowType = TimestampType;
+  using c_type = double;
+  static constexpr int sexp_type = REALSXP;
+  static constexpr bool has_sum = false;
+  static constexpr bool has_min_max = true;
+  static constexpr bool sortable = true;
+
+  explicit TimestampTraits(const DataType& type)
+      : multiplier_(Multiplier(internal::checked_cast<const TimestampType&>(type))) {}
+  double Value(int64_t value) const { return static_cast<double>(value) / multiplier_; }
+  static double na() { return NA_REAL; }
+  static void SetAttributes(SEXP alt, const DataType& type) {
+    Rf_classgets(alt, arrow::r::data::classes_POSIXct);
+    const auto& tzone = internal::checked_cast<const TimestampType&>(type).timezone();
+    if (tzone.size() > 0) {
+      Rf_setAttrib(alt, symbols::tzone, Rf_mkString(tzone.c_str()));
+    }
+  }
+
+ private:
+  static int64_t Multiplier(const TimestampType& type) {
+    switch (type.unit()) {
+      case TimeUnit::SECOND:
+        return 1;
+      case TimeUnit::MILLI:
+        return 1000;
+      case TimeUnit::MICRO:
+        return 1000000;
+      case TimeUnit::NANO:
+        return 1000000000;
+      default:
+        return 1;
+    }
+  }
+
+  int64_t multiplier_;
+};
+
+// altrep R vector shadowing an Array whose values need a conversion, see the
+// Traits above.
+//
+// Unlike AltrepVectorPrimitive, the Array data never has the layout R expects,
+// so Dataptr() always materializes, but Elt() and Get_region() convert only
+// the values they are asked for.
+template <typename Traits>
+struct AltrepVectorConverted : public AltrepVectorBase<AltrepVectorConverted<Traits>> {
+  using Base = AltrepVectorBase<AltrepVectorConverted<Traits>>;
+
+  // singleton altrep class description
+  static R_altrep_class_t class_t;
+
+  static constexpr int sexp_type = Traits::sexp_type;
+  using c_type = typename Traits::c_type;
+  using ArrowType = typename Traits::ArrowType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  using Base::IsMaterialized;
+  using Base::Representation;
+  using Base::SetRepresentation;
+
+  static SEXP Make(const std::shared_ptr<ChunkedArray>& chunked_array) {
+    SEXP alt = PROTECT(Base::Make(chunked_array));
+    Traits::SetAttributes(alt, *chunked_array->type());
+    UNPROTECT(1);
+    return alt;
+  }
+
+  static bool HasNaN(SEXP alt) {
+    if constexpr (is_floating_type<ArrowType>::value) {
+      return GetAltrepData(alt)->template has_nan<ArrowType>();
+    } else {
+      return false;
+    }
+  }
+
+  static int Sortedness(SEXP alt) {
+    if constexpr (!Traits::sortable) {
+      return UNKNOWN_SORTEDNESS;
+    } else {
+      Traits traits(*GetChunkedArray(alt)->type());
+      return GetAltrepData(alt)->template sortedness<ArrowType>(
+          [&](auto value) { return static_cast<double>(traits.Value(value)); });
+    }
+  }
+
+  static c_type* Values(SEXP x) {
+    if constexpr (sexp_type == REALSXP) {
+      return REAL(x);
+    } else if constexpr (sexp_type == INTSXP) {
+      return INTEGER(x);
+    } else {
+      return LOGICAL(x);
+    }
+  }
+
+  static SEXP Materialize(SEXP alt) {
+    if (!IsMaterialized(alt)) {
+      auto size = Base::Length(alt);
+
+      // create a standard R vector
+      SEXP copy = PROTECT(Rf_allocVector(sexp_type, size));
+
+      // convert the data from the array, through Get_region
+      Get_region(alt, 0, size, Values(copy));
+
+      // store as data2, this is now considered materialized
+      SetRepresentation(alt, copy);
+
+      // we no longer need the original ChunkedArray
+      R_set_altrep_data1(alt, R_NilValue);
+
+      UNPROTECT(1);
+    }
+    return Representation(alt);
+  }
+
+  static const void* Dataptr_or_null(SEXP alt) {
+    if (IsMaterialized(alt)) {
+      return DATAPTR_RO(Representation(alt));
+    }
+
+    return nullptr;
+  }
+
+  static void* Dataptr(SEXP alt, Rboolean writeable) { return Values(Materialize(alt)); }
+
+  // The value at position i
+  static c_type Elt(SEXP alt, R_xlen_t i) {
+    if (IsMaterialized(alt)) {
+      return Values(Representation(alt))[i];
+    }
+
+    auto altrep_data =
+        reinterpret_cast<ArrowAltrepData*>(R_ExternalPtrAddr(R_altrep_data1(alt)));
+    auto resolve = altrep_data->locate(i);
+    const auto& array =
+        altrep_data->chunked_array()->chunk(static_cast<int>(resolve.chunk_index));
+    auto j = resolve.index_in_chunk;
+
+    if (array->IsNull(j)) {
+      return Traits::na();
+    }
+
+    Traits traits(*array->type());
+    return traits.Value(internal::checked_cast<const ArrayType&>(*array).Value(j));
+  }
+
+  // Convert the values from position `i` to `i + n` into `buf`, and return the
+  // number of values that were really converted (this can be lower than n)
+  static R_xlen_t Get_region(SEXP alt, R_xlen_t i, R_xlen_t n, c_type* buf) {
+    if (IsMaterialized(alt)) {
+      if constexpr (sexp_type == REALSXP) {
+        return REAL_GET_REGION(Representation(alt), i, n, buf);
+      } else if constexpr (sexp_type == INTSXP) {
+        return INTEGER_GET_REGION(Representation(alt), i, n, buf);
+      } else {
+        return LOGICAL_GET_REGION(Representation(alt), i, n, buf);
+      }
+    }
+
+    Traits traits(*GetChunkedArray(alt)->type());
+
+    c_type* out = buf;
+    auto visit = [&](int, const std::shared_ptr<Array>& array, int64_t offset,
+                     int64_t length) {
+      ArraySpan span(*array->data());
+      span.SetSlice(array->offset() + offset, length);
+      VisitArraySpanInline<ArrowType>(
+          span,
+          /*valid_func=*/[&](auto value) { *out++ = traits.Value(value); },
+          /*null_func=*/[&]() { *out++ = Traits::na(); });
+    };
+
+    return GetAltrepData(alt)->VisitRegion(i, n, visit);
+  }
+
+  template <bool Min>
+  static SEXP MinMax(SEXP alt, Rboolean narm) {
+    if constexpr (!Traits::has_min_max) {
+      return nullptr;
+    } else {
+      if (IsMaterialized(alt)) {
+        return nullptr;
+      }
+
+      const auto& chunked_array = GetChunkedArray(alt);
+      bool na_rm = narm == TRUE;
+      auto n = chunked_array->length();
+      auto null_count = chunked_array->null_count();
+      if ((na_rm || n == 0) && null_count == n) {
+        if (Min) {
+          Rf_warning("no non-missing arguments to min; returning Inf");
+          return Rf_ScalarReal(R_PosInf);
+        } else {
+          Rf_warning("no non-missing arguments to max; returning -Inf");
+          return Rf_ScalarReal(R_NegInf);
+        }
+      }
+      if (!na_rm && null_count > 0) {
+        return cpp11::as_sexp(Traits::na());
+      }
+
+      auto options = AltrepVectorPrimitive<REALSXP>::NaRmOptions(na_rm);
+
+      const auto& minmax = ValueOrStop(
+          arrow::compute::CallFunction("min_max", {chunked_array}, options.get()));
+      const auto& minmax_scalar =
+          internal::checked_cast<const StructScalar&>(*minmax.scalar());
+
+      const auto& result_scalar = internal::checked_cast<const ScalarType&>(
+          *ValueOrStop(minmax_scalar.field(Min ? "min" : "max")));
+      Traits traits(*chunked_array->type());
+      return cpp11::as_sexp(traits.Value(result_scalar.value));
+    }
+  }
+
+  static SEXP Min(SEXP alt, Rboolean narm) { return MinMax<true>(alt, narm); }
+
+  static SEXP Max(SEXP alt, Rboolean narm) { return MinMax<false>(alt, narm); }
+
+  static SEXP Sum(SEXP alt, Rboolean narm) {
+    if constexpr (!Traits::has_sum) {
+      return nullptr;
+    } else {
+      if (IsMaterialized(alt)) {
+        return nullptr;
+      }
+
+      const auto& chunked_array = GetChunkedArray(alt);
+      bool na_rm = narm == TRUE;
+      if (!na_rm && chunked_array->null_count() > 0) {
+        return cpp11::as_sexp(Traits::na());
+      }
+      auto options = AltrepVectorPrimitive<REALSXP>::NaRmOptions(na_rm);
+
+      const auto& sum = ValueOrStop(
+          arrow::compute::CallFunction("sum", {chunked_array}, options.get()));
+
+      if constexpr (sexp_type == REALSXP) {
+        return Rf_ScalarReal(
+            internal::checked_cast<const DoubleScalar&>(*sum.scalar()).value);
+      } else {
+        // sum() of int64 gives an Int64 scalar and sum() of boolean an UInt64
+        // one: like R, use a double when the result does not fit in an int
+        auto int64_sum = ValueOrStop(sum.scalar()->CastTo(int64()));
+        int64_t value = internal::checked_cast<const Int64Scalar&>(*int64_sum).value;
+        if (value <= INT32_MIN || value > INT32_MAX) {
+          return Rf_ScalarReal(static_cast<double>(value));
+        } else {
+          return Rf_ScalarInteger(static_cast<int>(value));
+        }
+      }
+    }
+  }
+};
+template <typename Traits>
+R_altrep_class_t AltrepVectorConverted<Traits>::class_t;
+
 struct AltrepFactor : public AltrepVectorBase<AltrepFactor> {
   // singleton altrep class description
   static R_altrep_class_t class_t;
@@ -645,62 +1334,35 @@ struct AltrepFactor : public AltrepVectorBase<AltrepFactor> {
       return Standard_Get_region<int>(Representation(alt), start, n, buf);
     }
 
-    auto chunked_array = GetChunkedArray(alt);
-
-    // get out if there is nothing to do
-    auto chunked_array_size = chunked_array->length();
-    if (start >= chunked_array_size) return 0;
-
-    auto slice = GetChunkedArray(alt)->Slice(start, n);
-
-    if (WasUnified(alt)) {
-      int j = 0;
+    bool was_unified = WasUnified(alt);
 
-      // find out which is the first chunk of the chunk array
-      // that is present in the slice, because the main loop
-      // needs to refer to the correct transpose buffers
-      int64_t k = 0;
-      for (; j < chunked_array->num_chunks(); j++) {
-        auto nj = chunked_array->chunk(j)->length();
-        if (k + nj > start) {
-          break;
-        }
-
-        k += nj;
-      }
-
-      int* out = buf;
-      for (const auto& array : slice->chunks()) {
-        const auto& indices =
-            internal::checked_cast<const DictionaryArray&>(*array).indices();
+    int* out = buf;
+    auto visit = [&](int j, const std::shared_ptr<Array>& chunk, int64_t offset,
+                     int64_t length) {
+      auto array = (offset == 0 && length == chunk->length())
+                       ? chunk
+                       : chunk->Slice(offset, length);
+      const auto& indices =
+          internal::checked_cast<const DictionaryArray&>(*array).indices();
 
+      if (was_unified) {
         // using the transpose data for this chunk
         const auto* transpose_data =
             reinterpret_cast<const int32_t*>(GetArrayTransposed(alt, j)->data());
         auto transpose = [transpose_data](int64_t x) { return transpose_data[x]; };
 
         GetRegionDispatch(array, indices, transpose, out);
-
-        out += array->length();
-        j++;
-      }
-
-    } else {
-      // simpler case, identity transpose
-      auto transpose = [](int64_t x) { return static_cast<int>(x); };
-
-      int* out = buf;
-      for (const auto& array : slice->chunks()) {
-        const auto& indices =
-            internal::checked_cast<const DictionaryArray&>(*array).indices();
+      } else {
+        // simpler case, identity transpose
+        auto transpose = [](int64_t x) { return static_cast<int>(x); };
 
         GetRegionDispatch(array, indices, transpose, out);
-
-        out += array->length();
       }
-    }
 
-    return slice->length();
+      out += length;
+    };
+
+    return GetAltrepData(alt)->VisitRegion(start, n, visit);
   }
 
 #define CALL_GET_REGION_TRANSPOSE(TYPE_CLASS)                                      \
@@ -991,6 +1653,17 @@ void InitAltIntegerMethods(R_altrep_class_t class_t, DllInfo* dll) {
   R_set_altinteger_Get_region_method(class_t, AltrepClass::Get_region);
 }
 
+template <typename AltrepClass>
+void InitAltLogicalMethods(R_altrep_class_t class_t, DllInfo* dll) {
+  R_set_altlogical_No_NA_method(class_t, AltrepClass::No_NA);
+  R_set_altlogical_Is_sorted_method(class_t, AltrepClass::Is_sorted);
+
+  R_set_altlogical_Sum_method(class_t, AltrepClass::Sum);
+
+  R_set_altlogical_Elt_method(class_t, AltrepClass::Elt);
+  R_set_altlogical_Get_region_method(class_t, AltrepClass::Get_region);
+}
+
 template <typename AltrepClass>
 void InitAltRealClass(DllInfo* dll, const char* name) {
   AltrepClass::class_t = R_make_altreal_class(name, "arrow", dll);
@@ -1007,6 +1680,14 @@ void InitAltIntegerClass(DllInfo* dll, const char* name) {
   InitAltIntegerMethods<AltrepClass>(AltrepClass::class_t, dll);
 }
 
+template <typename AltrepClass>
+void InitAltLogicalClass(DllInfo* dll, const char* name) {
+  AltrepClass::class_t = R_make_altlogical_class(name, "arrow", dll);
+  InitAltrepMethods<AltrepClass>(AltrepClass::class_t, dll);
+  InitAltvecMethods<AltrepClass>(AltrepClass::class_t, dll);
+  InitAltLogicalMethods<AltrepClass>(AltrepClass::class_t, dll);
+}
+
 template <typename AltrepClass>
 void InitAltStringClass(DllInfo* dll, const char* name) {
   AltrepClass::class_t = R_make_altstring_class(name, "arrow", dll);
@@ -1035,6 +1716,19 @@ void Init_Altrep_classes(DllInfo* dll) {
   InitAltIntegerClass<AltrepVectorPrimitive<INTSXP>>(dll, "arrow::array_int_vector");
   InitAltIntegerClass<AltrepFactor>(dll, "arrow::array_factor");
 
+  InitAltRealClass<AltrepVectorConverted<Float32Traits>>(dll,
+                                                         "arrow::array_float_vector");
+  InitAltIntegerClass<AltrepVectorConverted<Int64DowncastTraits>>(
+      dll, "arrow::array_int64_int_vector");
+  InitAltRealClass<AltrepVectorConverted<Integer64Traits>>(
+      dll, "arrow::array_integer64_vector");
+  InitAltLogicalClass<AltrepVectorConverted<BooleanTraits>>(dll,
+                                                            "arrow::array_lgl_vector");
+  InitAltRealClass<AltrepVectorConverted<Date32Traits>>(dll,
+                                                        "arrow::array_date32_vector");
+  InitAltRealClass<AltrepVectorConverted<TimestampTraits>>(
+      dll, "arrow::array_timestamp_vector");
+
   InitAltStringClass<AltrepVectorString<StringType>>(dll, "arrow::array_string_vector");
   InitAltStringClass<AltrepVectorString<LargeStringType>>(
       dll, "arrow::array_large_string_vector");
@@ -1053,6 +1747,27 @@ SEXP MakeAltrepVector(const std::shared_ptr<ChunkedArray>& chunked_array) {
       case arrow::Type::INT32:
         return altrep::AltrepVectorPrimitive<INTSXP>::Make(chunked_array);
 
+      case arrow::Type::FLOAT:
+        return altrep::AltrepVectorConverted<Float32Traits>::Make(chunked_array);
+
+      case arrow::Type::INT64:
+        // Prefer integer if it fits, unless option arrow.int64_downcast is `false`
+        if (GetBoolOption("arrow.int64_downcast", true) &&
+            ArraysCanFitInteger(chunked_array->chunks())) {
+          return altrep::AltrepVectorConverted<Int64DowncastTraits>::Make(chunked_array);
+        } else {
+          return altrep::AltrepVectorConverted<Integer64Traits>::Make(chunked_array);
+        }
+
+      case arrow::Type::BOOL:
+        return altrep::AltrepVectorConverted<BooleanTraits>::Make(chunked_array);
+
+      case arrow::Type::DATE32:
+        return altrep::AltrepVectorConverted<Date32Traits>::Make(chunked_array);
+
+      case arrow::Type::TIMESTAMP:
+        return altrep::AltrepVectorConverted<TimestampTraits>::Make(chunked_array);
+
       case arrow::Type::STRING:
         return altrep::AltrepVectorString<StringType>::Make(chunked_array);
 
@@ -1083,6 +1798,15 @@ bool is_unmaterialized_arrow_altrep(SEXP x) {
   return is_arrow_altrep(x) && R_altrep_data1(x) != R_NilValue;
 }
 
+bool is_converted_arrow_altrep(SEXP x) {
+  return R_altrep_inherits(x, AltrepVectorConverted<Float32Traits>::class_t) ||
+         R_altrep_inherits(x, AltrepVectorConverted<Int64DowncastTraits>::class_t) ||
+         R_altrep_inherits(x, AltrepVectorConverted<Integer64Traits>::class_t) ||
+         R_altrep_inherits(x, AltrepVectorConverted<BooleanTraits>::class_t) ||
+         R_altrep_inherits(x, AltrepVectorConverted<Date32Traits>::class_t) ||
+         R_altrep_inherits(x, AltrepVectorConverted<TimestampTraits>::class_t);
+}
+
 std::shared_ptr<ChunkedArray> vec_to_arrow_altrep_bypass(SEXP x) {
   if (is_unmaterialized_arrow_altrep(x)) {
     return GetChunkedArray(x);
@@ -1128,6 +1852,24 @@ sexp test_arrow_altrep_is_materialized(sexp x) {
         arrow::r::altrep::AltrepVectorString<arrow::LargeStringType>::IsMaterialized(x);
   } else if (class_name == "arrow::array_factor") {
     result = arrow::r::altrep::AltrepFactor::IsMaterialized(x);
+  } else if (class_name == "arrow::array_float_vector") {
+    result = arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::Float32Traits>::IsMaterialized(x);
+  } else if (class_name == "arrow::array_int64_int_vector") {
+    result = arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::Int64DowncastTraits>::IsMaterialized(x);
+  } else if (class_name == "arrow::array_integer64_vector") {
+    result = arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::Integer64Traits>::IsMaterialized(x);
+  } else if (class_name == "arrow::array_lgl_vector") {
+    result = arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::BooleanTraits>::IsMaterialized(x);
+  } else if (class_name == "arrow::array_date32_vector") {
+    result = arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::Date32Traits>::IsMaterialized(x);
+  } else if (class_name == "arrow::array_timestamp_vector") {
+    result = arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::TimestampTraits>::IsMaterialized(x);
   }
 
   return Rf_ScalarLogical(result);
@@ -1157,6 +1899,24 @@ bool test_arrow_altrep_force_materialize(sexp x) {
     arrow::r::altrep::AltrepVectorString<arrow::LargeStringType>::Materialize(x);
   } else if (class_name == "arrow::array_factor") {
     arrow::r::altrep::AltrepFactor::Materialize(x);
+  } else if (class_name == "arrow::array_float_vector") {
+    arrow::r::altrep::AltrepVectorConverted<arrow::r::altrep::Float32Traits>::Materialize(
+        x);
+  } else if (class_name == "arrow::array_int64_int_vector") {
+    arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::Int64DowncastTraits>::Materialize(x);
+  } else if (class_name == "arrow::array_integer64_vector") {
+    arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::Integer64Traits>::Materialize(x);
+  } else if (class_name == "arrow::array_lgl_vector") {
+    arrow::r::altrep::AltrepVectorConverted<arrow::r::altrep::BooleanTraits>::Materialize(
+        x);
+  } else if (class_name == "arrow::array_date32_vector") {
+    arrow::r::altrep::AltrepVectorConverted<arrow::r::altrep::Date32Traits>::Materialize(
+        x);
+  } else if (class_name == "arrow::array_timestamp_vector") {
+    arrow::r::altrep::AltrepVectorConverted<
+        arrow::r::altrep::TimestampTraits>::Materialize(x);
   } else {
     return false;
   }
@@ -1184,6 +1944,12 @@ sexp test_arrow_altrep_copy_by_element(sexp x) {
       out[i] = REAL_ELT(x, i);
     }
     return out;
+  } else if (TYPEOF(x) == LGLSXP) {
+    cpp11::writable::logicals out(Rf_xlength(x));
+    for (R_xlen_t i = 0; i < n; i++) {
+      out[i] = LOGICAL_ELT(x, i);
+    }
+    return out;
   } else if (TYPEOF(x) == STRSXP) {
     cpp11::writable::strings out(Rf_xlength(x));
     for (R_xlen_t i = 0; i < n; i++) {
@@ -1225,6 +1991,17 @@ sexp test_arrow_altrep_copy_by_region(sexp x, R_xlen_t region_size) {
       out[i] = buf[i % region_size];
     }
     return out;
+  } else if (TYPEOF(x) == LGLSXP) {
+    cpp11::writable::logicals out(Rf_xlength(x));
+    cpp11::writable::logicals buf_shelter(region_size);
+    int* buf = LOGICAL(buf_shelter);
+    for (R_xlen_t i = 0; i < n; i++) {
+      if ((i % region_size) == 0) {
+        LOGICAL_GET_REGION(x, i, region_size, buf);
+      }
+      out[i] = buf[i % region_size];
+    }
+    return out;
   } else {
     return R_NilValue;
   }
@@ -1252,6 +2029,13 @@ sexp test_arrow_altrep_copy_by_dataptr(sexp x) {
       out[i] = ptr[i];
     }
     return out;
+  } else if (TYPEOF(x) == LGLSXP) {
+    cpp11::writable::logicals out(Rf_xlength(x));
+    int* ptr = LOGICAL(x);
+    for (R_xlen_t i = 0; i < n; i++) {
+      out[i] = ptr[i];
+    }
+    return out;
   } else {
     return R_NilValue;
   }
@@ -23,9 +23,13 @@
 #include <arrow/table.h>
 #include <arrow/util/bitmap_reader.h>
 #include <arrow/util/bitmap_writer.h>
+#include <arrow/util/future.h>
 #include <arrow/util/int_util.h>
 
+#include <atomic>
+#include <deque>
 #include <type_traits>
+#include <unordered_map>
 
 #include "./extension.h"
 #include "./r_task_group.h"
@@ -62,6 +66,15 @@ class Converter {
   // can this run in parallel ?
   virtual bool Parallel() const { return true; }
 
+  // Optional preparation of a chunk ahead of Ingest_some_nulls(). This never
+  // touches the R API and is always scheduled as a parallel task, so converters
+  // that must ingest on the main thread can move the rest of the work off it.
+  virtual bool Prepares() const { return false; }
+  virtual Status Prepare(const std::shared_ptr<arrow::Array>& array,
+                         size_t chunk_index) const {
+    return Status::OK();
+  }
+
   // converter is passed as self to outlive the scope of Converter::Convert()
   SEXP ScheduleConvertTasks(RTasks& tasks, std::shared_ptr<Converter> self) {
     // try altrep first
@@ -80,6 +93,10 @@ class Converter {
     for (const auto& array : chunked_array_->chunks()) {
       auto n_chunk = array->length();
 
+      if (Prepares() && array->null_count() != n_chunk) {
+        tasks.Append(true, [=] { return self->Prepare(array, i); });
+      }
+
       tasks.Append(Parallel(), [=] {
         if (array->null_count() == n_chunk) {
           return self->Ingest_all_nulls(out, k, n_chunk);
@@ -273,11 +290,74 @@ class Converter_Date32 : public Converter {
   }
 };
 
+// Work for one chunk of a string array that Converter_String can do away from
+// the main thread: each distinct value gets an index so that it is only turned
+// into a CHARSXP once, and embedded nuls are stripped ahead of time.
+struct StringChunkPlan {
+  // index into `values` for each element of the chunk, -1 for nulls
+  std::vector<int32_t> indices;
+  std::vector<std::string_view> values;
+
+  // owns the values that had their nuls stripped
+  std::deque<std::string> stripped;
+  bool nul_was_stripped = false;
+};
+
+// The plan of a chunk is built exactly once, either by the parallel Prepare()
+// task or by the main thread when it gets to the chunk first. The main thread
+// therefore only ever waits on a plan that is already being built. Once the
+// chunk is ingested its plan is released, and Get() returns nullptr.
+//
+// Only Build() may be called from other threads; Get() and Release() are for
+// the main thread, which is the only one to read or free the plan.
+class StringChunkPlanSlot {
+ public:
+  // Builds the plan unless another thread has already claimed the slot
+  template <typename BuildPlan>
+  void Build(BuildPlan&& build) {
+    if (!claimed_.exchange(true)) {
+      plan_ = build();
+      done_.MarkFinished();
+    }
+  }
+
+  template <typename BuildPlan>
+  const StringChunkPlan* Get(BuildPlan&& build) {
+    if (!claimed_.exchange(true)) {
+      plan_ = build();
+      done_.MarkFinished();
+    } else {
+      done_.Wait();
+    }
+    return plan_.get();
+  }
+
+  // Frees the plan, or keeps it from being built if that has not started yet
+  void Release() {
+    if (!claimed_.exchange(true)) {
+      done_.MarkFinished();
+    } else {
+      done_.Wait();
+    }
+    plan_.reset();
+  }
+
+ private:
+  std::atomic<bool> claimed_{false};
+  Future<> done_ = Future<>::Make();
+  std::unique_ptr<StringChunkPlan> plan_;
+};
+
 template <typename StringArrayType>
 struct Converter_String : public Converter {
  public:
   explicit Converter_String(const std::shared_ptr<ChunkedArray>& chunked_array)
-      : Converter(chunked_array) {}
+      : Converter(chunked_array),
+        strip_out_nuls_(GetBoolOption("arrow.skip_nul", false)) {
+    for (int i = 0; i < chunked_array->num_chunks(); i++) {
+      slots_.push_back(std::make_unique<StringChunkPlanSlot>());
+    }
+  }
 
   SEXP Allocate(R_xlen_t n) const { return Rf_allocVector(STRSXP, n); }
 
@@ -290,32 +370,49 @@ struct Converter_String : public Converter {
 
   Status Ingest_some_nulls(SEXP data, const std::shared_ptr<arrow::Array>& array,
                            R_xlen_t start, R_xlen_t n, size_t chunk_index) const {
-    auto p_offset = array->data()->GetValues<int32_t>(1);
-    if (!p_offset) {
-      return Status::Invalid("Invalid offset buffer");
-    }
-    auto p_strings = array->data()->GetValues<char>(2, *p_offset);
-    if (!p_strings) {
-      // There is an offset buffer, but the data buffer is null
-      // There is at least one value in the array and not all the values are null
-      // That means all values are either empty strings or nulls so there is nothing to do
-
-      if (array->null_count()) {
-        arrow::internal::BitmapReader null_reader(array->null_bitmap_data(),
-                                                  array->offset(), n);
-        for (int i = 0; i < n; i++, null_reader.Next()) {
-          if (null_reader.IsNotSet()) {
-            SET_STRING_ELT(data, start + i, NA_STRING);
+    // views carry their own lengths and may not have any data buffer at all
+    if constexpr (!std::is_same_v<StringArrayType, StringViewArray>) {
+      auto p_offset = array->data()->GetValues<int32_t>(1);
+      if (!p_offset) {
+        return Status::Invalid("Invalid offset buffer");
+      }
+      auto p_strings = array->data()->GetValues<char>(2, *p_offset);
+      if (!p_strings) {
+        // There is an offset buffer, but the data buffer is null
+        // There is at least one value in the array and not all the values are null
+        // That means all values are either empty strings or nulls so there is nothing
+        // to do
+        if (chunk_index < slots_.size()) {
+          slots_[chunk_index]->Release();
+        }
+
+        if (array->null_count()) {
+          arrow::internal::BitmapReader null_reader(array->null_bitmap_data(),
+                                                    array->offset(), n);
+          for (int i = 0; i < n; i++, null_reader.Next()) {
+            if (null_reader.IsNotSet()) {
+              SET_STRING_ELT(data, start + i, NA_STRING);
+            }
           }
         }
+        return Status::OK();
       }
-      return Status::OK();
+    }
+
+    const StringChunkPlan* plan = nullptr;
+    if (chunk_index < slots_.size()) {
+      plan = slots_[chunk_index]->Get([&] { return MakePlan(*array); });
+    }
+    if (plan != nullptr) {
+      Status status = IngestPlan(data, *plan, start, n);
+      slots_[chunk_index]->Release();
+      return status;
     }
 
     StringArrayType* string_array = static_cast<StringArrayType*>(array.get());
 
     const bool all_valid = array->null_count() == 0;
-    const bool strip_out_nuls = GetBoolOption("arrow.skip_nul", false);
+    const bool strip_out_nuls = strip_out_nuls_;
 
     bool nul_was_stripped = false;
 
@@ -372,7 +469,97 @@ struct Converter_String : public Converter {
 
   bool Parallel() const { return false; }
 
+  bool Prepares() const { return true; }
+
+  Status Prepare(const std::shared_ptr<arrow::Array>& array, size_t chunk_index) const {
+    slots_[chunk_index]->Build([&] { return MakePlan(*array); });
+    return Status::OK();
+  }
+
  private:
+  // Deduplication is given up on when more than half of the first
+  // kDedupProbeSize values are distinct
+  static constexpr int64_t kDedupProbeSize = 1024;
+
+  // Returns nullptr when deduplicating the chunk is not worth it, in which
+  // case the values are ingested one by one on the main thread
+  std::unique_ptr<StringChunkPlan> MakePlan(const arrow::Array& array) const {
+    const auto& string_array = checked_cast<const StringArrayType&>(array);
+    const int64_t n = string_array.length();
+
+    auto plan = std::make_unique<StringChunkPlan>();
+    plan->indices.resize(n, -1);
+
+    std::unordered_map<std::string_view, int32_t> index_of;
+    int64_t seen = 0;
+
+    for (int64_t i = 0; i < n; i++) {
+      if (string_array.IsNull(i)) {
+        continue;
+      }
+
+      std::string_view view = string_array.GetView(i);
+      auto inserted =
+          index_of.emplace(view, static_cast<int32_t>(plan->values.size()));
+      if (inserted.second) {
+        plan->values.push_back(strip_out_nuls_ ? StripNul(view, plan.get()) : view);
+      }
+      plan->indices[i] = inserted.first->second;
+
+      if (++seen == kDedupProbeSize &&
+          static_cast<int64_t>(plan->values.size()) > kDedupProbeSize / 2) {
+        return nullptr;
+      }
+    }
+
+    return plan;
+  }
+
+  static std::string_view StripNul(std::string_view view, StringChunkPlan* plan) {
+    if (view.find('\0') == std::string_view::npos) {
+      return view;
+    }
+
+    std::string stripped;
+    stripped.reserve(view.size());
+    for (char c : view) {
+      if (c != '\0') stripped.push_back(c);
+    }
+    plan->nul_was_stripped = true;
+    plan->stripped.push_back(std::move(stripped));
+    return plan->stripped.back();
+  }
+
+  // All that is left for the main thread: make one CHARSXP per distinct value,
+  // the first time it is used, and point the elements at it. A CHARSXP is
+  // protected by `data` as soon as it has been set once.
+  Status IngestPlan(SEXP data, const StringChunkPlan& plan, R_xlen_t start,
+                    R_xlen_t n) const {
+    std::vector<SEXP> charsxps(plan.values.size(), nullptr);
+
+    cpp11::unwind_protect([&] {
+      for (R_xlen_t i = 0; i < n; i++) {
+        int32_t index = plan.indices[i];
+        if (index < 0) {
+          SET_STRING_ELT(data, start + i, NA_STRING);
+          continue;
+        }
+
+        SEXP s = charsxps[index];
+        if (s == nullptr) {
+          s = charsxps[index] = r_string_from_view(plan.values[index]);
+        }
+        SET_STRING_ELT(data, start + i, s);
+      }
+    });
+
+    if (plan.nul_was_stripped) {
+      cpp11::safe[Rf_warning]("Stripping '\\0' (nul) from character vector");
+    }
+
+    return Status::OK();
+  }
+
   static SEXP r_string_from_view(std::string_view view) {
     return Rf_mkCharLenCE(view.data(), static_cast<int>(view.size()), CE_UTF8);
   }
@@ -1241,6 +1428,10 @@ std::shared_ptr<Converter> Converter::Make(
       return std::make_shared<arrow::r::Converter_String<arrow::LargeStringArray>>(
           chunked_array);
 
+    case Type::STRING_VIEW:
+      return std::make_shared<arrow::r::Converter_String<arrow::StringViewArray>>(
+          chunked_array);
+
     case Type::DICTIONARY:
       return std::make_shared<arrow::r::Converter_Dictionary>(chunked_array);
 
@@ -913,15 +913,17 @@ END_CPP11
 }
 // compute-exec.cpp
 #if defined(ARROW_R_WITH_ACERO)
-std::shared_ptr<acero::ExecPlan> ExecPlan_create(bool use_threads);
-extern "C" SEXP _arrow_ExecPlan_create(SEXP use_threads_sexp){
+std::shared_ptr<acero::ExecPlan> ExecPlan_create(bool use_threads, double memory_limit, double spill_memory_limit);
+extern "C" SEXP _arrow_ExecPlan_create(SEXP use_threads_sexp, SEXP memory_limit_sexp, SEXP spill_memory_limit_sexp){
 BEGIN_CPP11
 	arrow::r::Input<bool>::type use_threads(use_threads_sexp);
-	return cpp11::as_sexp(ExecPlan_create(use_threads));
+	arrow::r::Input<double>::type memory_limit(memory_limit_sexp);
+	arrow::r::Input<double>::type spill_memory_limit(spill_memory_limit_sexp);
+	return cpp11::as_sexp(ExecPlan_create(use_threads, memory_limit, spill_memory_limit));
 END_CPP11
 }
 #else
-extern "C" SEXP _arrow_ExecPlan_create(SEXP use_threads_sexp){
+extern "C" SEXP _arrow_ExecPlan_create(SEXP use_threads_sexp, SEXP memory_limit_sexp, SEXP spill_memory_limit_sexp){
 	Rf_error("Cannot call ExecPlan_create(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
 }
 #endif
@@ -988,17 +990,48 @@ extern "C" SEXP _arrow_ExecPlanReader__PlanStatus(SEXP reader_sexp){
 
 // compute-exec.cpp
 #if defined(ARROW_R_WITH_ACERO)
-std::shared_ptr<ExecPlanReader> ExecPlan_run(const std::shared_ptr<acero::ExecPlan>& plan, const std::shared_ptr<acero::ExecNode>& final_node, cpp11::strings metadata);
-extern "C" SEXP _arrow_ExecPlan_run(SEXP plan_sexp, SEXP final_node_sexp, SEXP metadata_sexp){
+cpp11::list ExecPlanReader__Stats(const std::shared_ptr<ExecPlanReader>& reader);
+extern "C" SEXP _arrow_ExecPlanReader__Stats(SEXP reader_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<ExecPlanReader>&>::type reader(reader_sexp);
+	return cpp11::as_sexp(ExecPlanReader__Stats(reader));
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_ExecPlanReader__Stats(SEXP reader_sexp){
+	Rf_error("Cannot call ExecPlanReader__Stats(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
+// compute-exec.cpp
+#if defined(ARROW_R_WITH_ACERO)
+cpp11::list ExecPlanReader__MemoryStats(const std::shared_ptr<ExecPlanReader>& reader);
+extern "C" SEXP _arrow_ExecPlanReader__MemoryStats(SEXP reader_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<ExecPlanReader>&>::type reader(reader_sexp);
+	return cpp11::as_sexp(ExecPlanReader__MemoryStats(reader));
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_ExecPlanReader__MemoryStats(SEXP reader_sexp){
+	Rf_error("Cannot call ExecPlanReader__MemoryStats(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
+// compute-exec.cpp
+#if defined(ARROW_R_WITH_ACERO)
+std::shared_ptr<ExecPlanReader> ExecPlan_run(const std::shared_ptr<acero::ExecPlan>& plan, const std::shared_ptr<acero::ExecNode>& final_node, cpp11::strings metadata, double max_queued_bytes);
+extern "C" SEXP _arrow_ExecPlan_run(SEXP plan_sexp, SEXP final_node_sexp, SEXP metadata_sexp, SEXP max_queued_bytes_sexp){
 BEGIN_CPP11
 	arrow::r::Input<const std::shared_ptr<acero::ExecPlan>&>::type plan(plan_sexp);
 	arrow::r::Input<const std::shared_ptr<acero::ExecNode>&>::type final_node(final_node_sexp);
 	arrow::r::Input<cpp11::strings>::type metadata(metadata_sexp);
-	return cpp11::as_sexp(ExecPlan_run(plan, final_node, metadata));
+	arrow::r::Input<double>::type max_queued_bytes(max_queued_bytes_sexp);
+	return cpp11::as_sexp(ExecPlan_run(plan, final_node, metadata, max_queued_bytes));
 END_CPP11
 }
 #else
-extern "C" SEXP _arrow_ExecPlan_run(SEXP plan_sexp, SEXP final_node_sexp, SEXP metadata_sexp){
+extern "C" SEXP _arrow_ExecPlan_run(SEXP plan_sexp, SEXP final_node_sexp, SEXP metadata_sexp, SEXP max_queued_bytes_sexp){
 	Rf_error("Cannot call ExecPlan_run(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
 }
 #endif
@@ -1162,6 +1195,23 @@ extern "C" SEXP _arrow_ExecNode_Aggregate(SEXP input_sexp, SEXP options_sexp, SE
 }
 #endif
 
+// compute-exec.cpp
+#if defined(ARROW_R_WITH_ACERO)
+std::shared_ptr<acero::ExecNode> ExecNode_Window(const std::shared_ptr<acero::ExecNode>& input, cpp11::list options, std::vector<std::string> key_names);
+extern "C" SEXP _arrow_ExecNode_Window(SEXP input_sexp, SEXP options_sexp, SEXP key_names_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<acero::ExecNode>&>::type input(input_sexp);
+	arrow::r::Input<cpp11::list>::type options(options_sexp);
+	arrow::r::Input<std::vector<std::string>>::type key_names(key_names_sexp);
+	return cpp11::as_sexp(ExecNode_Window(input, options, key_names));
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_ExecNode_Window(SEXP input_sexp, SEXP options_sexp, SEXP key_names_sexp){
+	Rf_error("Cannot call ExecNode_Window(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // compute-exec.cpp
 #if defined(ARROW_R_WITH_ACERO)
 std::shared_ptr<acero::ExecNode> ExecNode_Join(const std::shared_ptr<acero::ExecNode>& input, acero::JoinType join_type, const std::shared_ptr<acero::ExecNode>& right_data, std::vector<std::string> left_keys, std::vector<std::string> right_keys, std::vector<std::string> left_output, std::vector<std::string> right_output, std::string output_suffix_for_left, std::string output_suffix_for_right, bool na_matches);
@@ -1186,6 +1236,33 @@ extern "C" SEXP _arrow_ExecNode_Join(SEXP input_sexp, SEXP join_type_sexp, SEXP
 }
 #endif
 
+// compute-exec.cpp
+#if defined(ARROW_R_WITH_ACERO)
+std::shared_ptr<acero::ExecNode> ExecNode_RangeJoin(const std::shared_ptr<acero::ExecNode>& input, acero::JoinType join_type, const std::shared_ptr<acero::ExecNode>& right_data, std::vector<std::string> left_keys, std::vector<std::string> right_keys, std::vector<std::string> condition_left, std::vector<std::string> condition_cmp, std::vector<std::string> condition_right, std::vector<std::string> left_output, std::vector<std::string> right_output, std::string output_suffix_for_left, std::string output_suffix_for_right, bool na_matches);
+extern "C" SEXP _arrow_ExecNode_RangeJoin(SEXP input_sexp, SEXP join_type_sexp, SEXP right_data_sexp, SEXP left_keys_sexp, SEXP right_keys_sexp, SEXP condition_left_sexp, SEXP condition_cmp_sexp, SEXP condition_right_sexp, SEXP left_output_sexp, SEXP right_output_sexp, SEXP output_suffix_for_left_sexp, SEXP output_suffix_for_right_sexp, SEXP na_matches_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<acero::ExecNode>&>::type input(input_sexp);
+	arrow::r::Input<acero::JoinType>::type join_type(join_type_sexp);
+	arrow::r::Input<const std::shared_ptr<acero::ExecNode>&>::type right_data(right_data_sexp);
+	arrow::r::Input<std::vector<std::string>>::type left_keys(left_keys_sexp);
+	arrow::r::Input<std::vector<std::string>>::type right_keys(right_keys_sexp);
+	arrow::r::Input<std::vector<std::string>>::type condition_left(condition_left_sexp);
+	arrow::r::Input<std::vector<std::string>>::type condition_cmp(condition_cmp_sexp);
+	arrow::r::Input<std::vector<std::string>>::type condition_right(condition_right_sexp);
+	arrow::r::Input<std::vector<std::string>>::type left_output(left_output_sexp);
+	arrow::r::Input<std::vector<std::string>>::type right_output(right_output_sexp);
+	arrow::r::Input<std::string>::type output_suffix_for_left(output_suffix_for_left_sexp);
+	arrow::r::Input<std::string>::type output_suffix_for_right(output_suffix_for_right_sexp);
+	arrow::r::Input<bool>::type na_matches(na_matches_sexp);
+	return cpp11::as_sexp(ExecNode_RangeJoin(input, join_type, right_data, left_keys, right_keys, condition_left, condition_cmp, condition_right, left_output, right_output, output_suffix_for_left, output_suffix_for_right, na_matches));
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_ExecNode_RangeJoin(SEXP input_sexp, SEXP join_type_sexp, SEXP right_data_sexp, SEXP left_keys_sexp, SEXP right_keys_sexp, SEXP condition_left_sexp, SEXP condition_cmp_sexp, SEXP condition_right_sexp, SEXP left_output_sexp, SEXP right_output_sexp, SEXP output_suffix_for_left_sexp, SEXP output_suffix_for_right_sexp, SEXP na_matches_sexp){
+	Rf_error("Cannot call ExecNode_RangeJoin(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // compute-exec.cpp
 #if defined(ARROW_R_WITH_ACERO)
 std::shared_ptr<acero::ExecNode> ExecNode_Union(const std::shared_ptr<acero::ExecNode>& input, const std::shared_ptr<acero::ExecNode>& right_data);
@@ -1221,20 +1298,40 @@ extern "C" SEXP _arrow_ExecNode_Fetch(SEXP input_sexp, SEXP offset_sexp, SEXP li
 
 // compute-exec.cpp
 #if defined(ARROW_R_WITH_ACERO)
-std::shared_ptr<acero::ExecNode> ExecNode_OrderBy(const std::shared_ptr<acero::ExecNode>& input, cpp11::list sort_options);
-extern "C" SEXP _arrow_ExecNode_OrderBy(SEXP input_sexp, SEXP sort_options_sexp){
+std::shared_ptr<acero::ExecNode> ExecNode_OrderBy(const std::shared_ptr<acero::ExecNode>& input, cpp11::list sort_options, double sort_run_length);
+extern "C" SEXP _arrow_ExecNode_OrderBy(SEXP input_sexp, SEXP sort_options_sexp, SEXP sort_run_length_sexp){
 BEGIN_CPP11
 	arrow::r::Input<const std::shared_ptr<acero::ExecNode>&>::type input(input_sexp);
 	arrow::r::Input<cpp11::list>::type sort_options(sort_options_sexp);
-	return cpp11::as_sexp(ExecNode_OrderBy(input, sort_options));
+	arrow::r::Input<double>::type sort_run_length(sort_run_length_sexp);
+	return cpp11::as_sexp(ExecNode_OrderBy(input, sort_options, sort_run_length));
 END_CPP11
 }
 #else
-extern "C" SEXP _arrow_ExecNode_OrderBy(SEXP input_sexp, SEXP sort_options_sexp){
+extern "C" SEXP _arrow_ExecNode_OrderBy(SEXP input_sexp, SEXP sort_options_sexp, SEXP sort_run_length_sexp){
 	Rf_error("Cannot call ExecNode_OrderBy(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
 }
 #endif
 
+// compute-exec.cpp
+#if defined(ARROW_R_WITH_ACERO)
+std::shared_ptr<acero::ExecNode> ExecNode_TopK(const std::shared_ptr<acero::ExecNode>& input, cpp11::list sort_options, int64_t k, bool with_ties, std::vector<std::string> key_names);
+extern "C" SEXP _arrow_ExecNode_TopK(SEXP input_sexp, SEXP sort_options_sexp, SEXP k_sexp, SEXP with_ties_sexp, SEXP key_names_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<acero::ExecNode>&>::type input(input_sexp);
+	arrow::r::Input<cpp11::list>::type sort_options(sort_options_sexp);
+	arrow::r::Input<int64_t>::type k(k_sexp);
+	arrow::r::Input<bool>::type with_ties(with_ties_sexp);
+	arrow::r::Input<std::vector<std::string>>::type key_names(key_names_sexp);
+	return cpp11::as_sexp(ExecNode_TopK(input, sort_options, k, with_ties, key_names));
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_ExecNode_TopK(SEXP input_sexp, SEXP sort_options_sexp, SEXP k_sexp, SEXP with_ties_sexp, SEXP key_names_sexp){
+	Rf_error("Cannot call ExecNode_TopK(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // compute-exec.cpp
 #if defined(ARROW_R_WITH_ACERO)
 std::shared_ptr<acero::ExecNode> ExecNode_SourceNode(const std::shared_ptr<acero::ExecPlan>& plan, const std::shared_ptr<arrow::RecordBatchReader>& reader);
@@ -2034,23 +2131,54 @@ extern "C" SEXP _arrow_dataset___JsonFragmentScanOptions__Make(SEXP parse_option
 
 // dataset.cpp
 #if defined(ARROW_R_WITH_DATASET)
-std::shared_ptr<ds::ParquetFragmentScanOptions> dataset___ParquetFragmentScanOptions__Make(bool use_buffered_stream, int64_t buffer_size, bool pre_buffer, int32_t thrift_string_size_limit, int32_t thrift_container_size_limit);
-extern "C" SEXP _arrow_dataset___ParquetFragmentScanOptions__Make(SEXP use_buffered_stream_sexp, SEXP buffer_size_sexp, SEXP pre_buffer_sexp, SEXP thrift_string_size_limit_sexp, SEXP thrift_container_size_limit_sexp){
+std::shared_ptr<ds::ParquetFragmentScanOptions> dataset___ParquetFragmentScanOptions__Make(bool use_buffered_stream, int64_t buffer_size, bool pre_buffer, int32_t thrift_string_size_limit, int32_t thrift_container_size_limit, bool load_statistics);
+extern "C" SEXP _arrow_dataset___ParquetFragmentScanOptions__Make(SEXP use_buffered_stream_sexp, SEXP buffer_size_sexp, SEXP pre_buffer_sexp, SEXP thrift_string_size_limit_sexp, SEXP thrift_container_size_limit_sexp, SEXP load_statistics_sexp){
 BEGIN_CPP11
 	arrow::r::Input<bool>::type use_buffered_stream(use_buffered_stream_sexp);
 	arrow::r::Input<int64_t>::type buffer_size(buffer_size_sexp);
 	arrow::r::Input<bool>::type pre_buffer(pre_buffer_sexp);
 	arrow::r::Input<int32_t>::type thrift_string_size_limit(thrift_string_size_limit_sexp);
 	arrow::r::Input<int32_t>::type thrift_container_size_limit(thrift_container_size_limit_sexp);
-	return cpp11::as_sexp(dataset___ParquetFragmentScanOptions__Make(use_buffered_stream, buffer_size, pre_buffer, thrift_string_size_limit, thrift_container_size_limit));
+	arrow::r::Input<bool>::type load_statistics(load_statistics_sexp);
+	return cpp11::as_sexp(dataset___ParquetFragmentScanOptions__Make(use_buffered_stream, buffer_size, pre_buffer, thrift_string_size_limit, thrift_container_size_limit, load_statistics));
 END_CPP11
 }
 #else
-extern "C" SEXP _arrow_dataset___ParquetFragmentScanOptions__Make(SEXP use_buffered_stream_sexp, SEXP buffer_size_sexp, SEXP pre_buffer_sexp, SEXP thrift_string_size_limit_sexp, SEXP thrift_container_size_limit_sexp){
+extern "C" SEXP _arrow_dataset___ParquetFragmentScanOptions__Make(SEXP use_buffered_stream_sexp, SEXP buffer_size_sexp, SEXP pre_buffer_sexp, SEXP thrift_string_size_limit_sexp, SEXP thrift_container_size_limit_sexp, SEXP load_statistics_sexp){
 	Rf_error("Cannot call dataset___ParquetFragmentScanOptions__Make(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
 }
 #endif
 
+// dataset.cpp
+#if defined(ARROW_R_WITH_DATASET)
+double dataset___GetParquetMetadataCacheCapacity();
+extern "C" SEXP _arrow_dataset___GetParquetMetadataCacheCapacity(){
+BEGIN_CPP11
+	return cpp11::as_sexp(dataset___GetParquetMetadataCacheCapacity());
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_dataset___GetParquetMetadataCacheCapacity(){
+	Rf_error("Cannot call dataset___GetParquetMetadataCacheCapacity(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
+// dataset.cpp
+#if defined(ARROW_R_WITH_DATASET)
+void dataset___SetParquetMetadataCacheCapacity(int64_t capacity);
+extern "C" SEXP _arrow_dataset___SetParquetMetadataCacheCapacity(SEXP capacity_sexp){
+BEGIN_CPP11
+	arrow::r::Input<int64_t>::type capacity(capacity_sexp);
+	dataset___SetParquetMetadataCacheCapacity(capacity);
+	return R_NilValue;
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_dataset___SetParquetMetadataCacheCapacity(SEXP capacity_sexp){
+	Rf_error("Cannot call dataset___SetParquetMetadataCacheCapacity(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // dataset.cpp
 #if defined(ARROW_R_WITH_DATASET)
 std::shared_ptr<ds::DirectoryPartitioning> dataset___DirectoryPartitioning(const std::shared_ptr<arrow::Schema>& schm, const std::string& segment_encoding);
@@ -2517,6 +2645,13 @@ BEGIN_CPP11
 END_CPP11
 }
 // datatype.cpp
+std::shared_ptr<arrow::DataType> Utf8View__initialize();
+extern "C" SEXP _arrow_Utf8View__initialize(){
+BEGIN_CPP11
+	return cpp11::as_sexp(Utf8View__initialize());
+END_CPP11
+}
+// datatype.cpp
 std::shared_ptr<arrow::DataType> Binary__initialize();
 extern "C" SEXP _arrow_Binary__initialize(){
 BEGIN_CPP11
@@ -3976,6 +4111,22 @@ BEGIN_CPP11
 END_CPP11
 }
 // memorypool.cpp
+double MemoryPool__total_bytes_allocated(const std::shared_ptr<arrow::MemoryPool>& pool);
+extern "C" SEXP _arrow_MemoryPool__total_bytes_allocated(SEXP pool_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<arrow::MemoryPool>&>::type pool(pool_sexp);
+	return cpp11::as_sexp(MemoryPool__total_bytes_allocated(pool));
+END_CPP11
+}
+// memorypool.cpp
+double MemoryPool__num_allocations(const std::shared_ptr<arrow::MemoryPool>& pool);
+extern "C" SEXP _arrow_MemoryPool__num_allocations(SEXP pool_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<arrow::MemoryPool>&>::type pool(pool_sexp);
+	return cpp11::as_sexp(MemoryPool__num_allocations(pool));
+END_CPP11
+}
+// memorypool.cpp
 std::string MemoryPool__backend_name(const std::shared_ptr<arrow::MemoryPool>& pool);
 extern "C" SEXP _arrow_MemoryPool__backend_name(SEXP pool_sexp){
 BEGIN_CPP11
@@ -4280,6 +4431,38 @@ extern "C" SEXP _arrow_parquet___arrow___ArrowReaderProperties__get_coerce_int96
 }
 #endif
 
+// parquet.cpp
+#if defined(ARROW_R_WITH_PARQUET)
+void parquet___arrow___ArrowReaderProperties__set_load_statistics(const std::shared_ptr<parquet::ArrowReaderProperties>& properties, bool load_statistics);
+extern "C" SEXP _arrow_parquet___arrow___ArrowReaderProperties__set_load_statistics(SEXP properties_sexp, SEXP load_statistics_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<parquet::ArrowReaderProperties>&>::type properties(properties_sexp);
+	arrow::r::Input<bool>::type load_statistics(load_statistics_sexp);
+	parquet___arrow___ArrowReaderProperties__set_load_statistics(properties, load_statistics);
+	return R_NilValue;
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_parquet___arrow___ArrowReaderProperties__set_load_statistics(SEXP properties_sexp, SEXP load_statistics_sexp){
+	Rf_error("Cannot call parquet___arrow___ArrowReaderProperties__set_load_statistics(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
+// parquet.cpp
+#if defined(ARROW_R_WITH_PARQUET)
+bool parquet___arrow___ArrowReaderProperties__get_load_statistics(const std::shared_ptr<parquet::ArrowReaderProperties>& properties);
+extern "C" SEXP _arrow_parquet___arrow___ArrowReaderProperties__get_load_statistics(SEXP properties_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<parquet::ArrowReaderProperties>&>::type properties(properties_sexp);
+	return cpp11::as_sexp(parquet___arrow___ArrowReaderProperties__get_load_statistics(properties));
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_parquet___arrow___ArrowReaderProperties__get_load_statistics(SEXP properties_sexp){
+	Rf_error("Cannot call parquet___arrow___ArrowReaderProperties__get_load_statistics(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // parquet.cpp
 #if defined(ARROW_R_WITH_PARQUET)
 std::shared_ptr<parquet::arrow::FileReader> parquet___arrow___FileReader__OpenFile(const std::shared_ptr<arrow::io::RandomAccessFile>& file, const std::shared_ptr<parquet::ArrowReaderProperties>& props, const std::shared_ptr<parquet::ReaderProperties>& reader_props);
@@ -4575,6 +4758,24 @@ extern "C" SEXP _arrow_parquet___ArrowWriterProperties___Builder__set_write_stat
 }
 #endif
 
+// parquet.cpp
+#if defined(ARROW_R_WITH_PARQUET)
+void parquet___ArrowWriterProperties___Builder__set_write_page_index(const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder, const std::vector<std::string>& paths, cpp11::logicals write_page_index);
+extern "C" SEXP _arrow_parquet___ArrowWriterProperties___Builder__set_write_page_index(SEXP builder_sexp, SEXP paths_sexp, SEXP write_page_index_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<parquet::WriterPropertiesBuilder>&>::type builder(builder_sexp);
+	arrow::r::Input<const std::vector<std::string>&>::type paths(paths_sexp);
+	arrow::r::Input<cpp11::logicals>::type write_page_index(write_page_index_sexp);
+	parquet___ArrowWriterProperties___Builder__set_write_page_index(builder, paths, write_page_index);
+	return R_NilValue;
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_parquet___ArrowWriterProperties___Builder__set_write_page_index(SEXP builder_sexp, SEXP paths_sexp, SEXP write_page_index_sexp){
+	Rf_error("Cannot call parquet___ArrowWriterProperties___Builder__set_write_page_index(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // parquet.cpp
 #if defined(ARROW_R_WITH_PARQUET)
 void parquet___ArrowWriterProperties___Builder__data_page_size(const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder, int64_t data_page_size);
@@ -4592,6 +4793,25 @@ extern "C" SEXP _arrow_parquet___ArrowWriterProperties___Builder__data_page_size
 }
 #endif
 
+// parquet.cpp
+#if defined(ARROW_R_WITH_PARQUET)
+void parquet___WriterProperties___Builder__enable_bloom_filter(const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder, const std::vector<std::string>& paths, cpp11::integers ndv, cpp11::doubles fpp);
+extern "C" SEXP _arrow_parquet___WriterProperties___Builder__enable_bloom_filter(SEXP builder_sexp, SEXP paths_sexp, SEXP ndv_sexp, SEXP fpp_sexp){
+BEGIN_CPP11
+	arrow::r::Input<const std::shared_ptr<parquet::WriterPropertiesBuilder>&>::type builder(builder_sexp);
+	arrow::r::Input<const std::vector<std::string>&>::type paths(paths_sexp);
+	arrow::r::Input<cpp11::integers>::type ndv(ndv_sexp);
+	arrow::r::Input<cpp11::doubles>::type fpp(fpp_sexp);
+	parquet___WriterProperties___Builder__enable_bloom_filter(builder, paths, ndv, fpp);
+	return R_NilValue;
+END_CPP11
+}
+#else
+extern "C" SEXP _arrow_parquet___WriterProperties___Builder__enable_bloom_filter(SEXP builder_sexp, SEXP paths_sexp, SEXP ndv_sexp, SEXP fpp_sexp){
+	Rf_error("Cannot call parquet___WriterProperties___Builder__enable_bloom_filter(). See https://arrow.apache.org/docs/r/articles/install.html for help installing Arrow C++ libraries. ");
+}
+#endif
+
 // parquet.cpp
 #if defined(ARROW_R_WITH_PARQUET)
 std::shared_ptr<parquet::WriterProperties> parquet___WriterProperties___Builder__build(const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder);
@@ -5813,12 +6033,14 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_util___Codec__IsAvailable", (DL_FUNC) &_arrow_util___Codec__IsAvailable, 1}, 
 		{ "_arrow_io___CompressedOutputStream__Make", (DL_FUNC) &_arrow_io___CompressedOutputStream__Make, 2}, 
 		{ "_arrow_io___CompressedInputStream__Make", (DL_FUNC) &_arrow_io___CompressedInputStream__Make, 2}, 
-		{ "_arrow_ExecPlan_create", (DL_FUNC) &_arrow_ExecPlan_create, 1}, 
+		{ "_arrow_ExecPlan_create", (DL_FUNC) &_arrow_ExecPlan_create, 3}, 
 		{ "_arrow_ExecPlanReader__batches", (DL_FUNC) &_arrow_ExecPlanReader__batches, 1}, 
 		{ "_arrow_Table__from_ExecPlanReader", (DL_FUNC) &_arrow_Table__from_ExecPlanReader, 1}, 
 		{ "_arrow_ExecPlanReader__Plan", (DL_FUNC) &_arrow_ExecPlanReader__Plan, 1}, 
 		{ "_arrow_ExecPlanReader__PlanStatus", (DL_FUNC) &_arrow_ExecPlanReader__PlanStatus, 1}, 
-		{ "_arrow_ExecPlan_run", (DL_FUNC) &_arrow_ExecPlan_run, 3}, 
+		{ "_arrow_ExecPlanReader__Stats", (DL_FUNC) &_arrow_ExecPlanReader__Stats, 1}, 
+		{ "_arrow_ExecPlanReader__MemoryStats", (DL_FUNC) &_arrow_ExecPlanReader__MemoryStats, 1}, 
+		{ "_arrow_ExecPlan_run", (DL_FUNC) &_arrow_ExecPlan_run, 4}, 
 		{ "_arrow_ExecPlan_ToString", (DL_FUNC) &_arrow_ExecPlan_ToString, 1}, 
 		{ "_arrow_ExecPlan_UnsafeDelete", (DL_FUNC) &_arrow_ExecPlan_UnsafeDelete, 1}, 
 		{ "_arrow_ExecNode_output_schema", (DL_FUNC) &_arrow_ExecNode_output_schema, 1}, 
@@ -5828,10 +6050,13 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_ExecNode_Filter", (DL_FUNC) &_arrow_ExecNode_Filter, 2}, 
 		{ "_arrow_ExecNode_Project", (DL_FUNC) &_arrow_ExecNode_Project, 3}, 
 		{ "_arrow_ExecNode_Aggregate", (DL_FUNC) &_arrow_ExecNode_Aggregate, 3}, 
+		{ "_arrow_ExecNode_Window", (DL_FUNC) &_arrow_ExecNode_Window, 3}, 
 		{ "_arrow_ExecNode_Join", (DL_FUNC) &_arrow_ExecNode_Join, 10}, 
+		{ "_arrow_ExecNode_RangeJoin", (DL_FUNC) &_arrow_ExecNode_RangeJoin, 13}, 
 		{ "_arrow_ExecNode_Union", (DL_FUNC) &_arrow_ExecNode_Union, 2}, 
 		{ "_arrow_ExecNode_Fetch", (DL_FUNC) &_arrow_ExecNode_Fetch, 3}, 
-		{ "_arrow_ExecNode_OrderBy", (DL_FUNC) &_arrow_ExecNode_OrderBy, 2}, 
+		{ "_arrow_ExecNode_OrderBy", (DL_FUNC) &_arrow_ExecNode_OrderBy, 3}, 
+		{ "_arrow_ExecNode_TopK", (DL_FUNC) &_arrow_ExecNode_TopK, 5}, 
 		{ "_arrow_ExecNode_SourceNode", (DL_FUNC) &_arrow_ExecNode_SourceNode, 2}, 
 		{ "_arrow_ExecNode_TableSourceNode", (DL_FUNC) &_arrow_ExecNode_TableSourceNode, 2}, 
 		{ "_arrow_substrait__internal__SubstraitToJSON", (DL_FUNC) &_arrow_substrait__internal__SubstraitToJSON, 1}, 
@@ -5895,7 +6120,9 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_dataset___FragmentScanOptions__type_name", (DL_FUNC) &_arrow_dataset___FragmentScanOptions__type_name, 1}, 
 		{ "_arrow_dataset___CsvFragmentScanOptions__Make", (DL_FUNC) &_arrow_dataset___CsvFragmentScanOptions__Make, 2}, 
 		{ "_arrow_dataset___JsonFragmentScanOptions__Make", (DL_FUNC) &_arrow_dataset___JsonFragmentScanOptions__Make, 2}, 
-		{ "_arrow_dataset___ParquetFragmentScanOptions__Make", (DL_FUNC) &_arrow_dataset___ParquetFragmentScanOptions__Make, 5}, 
+		{ "_arrow_dataset___ParquetFragmentScanOptions__Make", (DL_FUNC) &_arrow_dataset___ParquetFragmentScanOptions__Make, 6}, 
+		{ "_arrow_dataset___GetParquetMetadataCacheCapacity", (DL_FUNC) &_arrow_dataset___GetParquetMetadataCacheCapacity, 0}, 
+		{ "_arrow_dataset___SetParquetMetadataCacheCapacity", (DL_FUNC) &_arrow_dataset___SetParquetMetadataCacheCapacity, 1}, 
 		{ "_arrow_dataset___DirectoryPartitioning", (DL_FUNC) &_arrow_dataset___DirectoryPartitioning, 2}, 
 		{ "_arrow_dataset___DirectoryPartitioning__MakeFactory", (DL_FUNC) &_arrow_dataset___DirectoryPartitioning__MakeFactory, 2}, 
 		{ "_arrow_dataset___HivePartitioning", (DL_FUNC) &_arrow_dataset___HivePartitioning, 3}, 
@@ -5933,6 +6160,7 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_Boolean__initialize", (DL_FUNC) &_arrow_Boolean__initialize, 0}, 
 		{ "_arrow_Utf8__initialize", (DL_FUNC) &_arrow_Utf8__initialize, 0}, 
 		{ "_arrow_LargeUtf8__initialize", (DL_FUNC) &_arrow_LargeUtf8__initialize, 0}, 
+		{ "_arrow_Utf8View__initialize", (DL_FUNC) &_arrow_Utf8View__initialize, 0}, 
 		{ "_arrow_Binary__initialize", (DL_FUNC) &_arrow_Binary__initialize, 0}, 
 		{ "_arrow_LargeBinary__initialize", (DL_FUNC) &_arrow_LargeBinary__initialize, 0}, 
 		{ "_arrow_Date32__initialize", (DL_FUNC) &_arrow_Date32__initialize, 0}, 
@@ -6094,6 +6322,8 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_MemoryPool__default", (DL_FUNC) &_arrow_MemoryPool__default, 0}, 
 		{ "_arrow_MemoryPool__bytes_allocated", (DL_FUNC) &_arrow_MemoryPool__bytes_allocated, 1}, 
 		{ "_arrow_MemoryPool__max_memory", (DL_FUNC) &_arrow_MemoryPool__max_memory, 1}, 
+		{ "_arrow_MemoryPool__total_bytes_allocated", (DL_FUNC) &_arrow_MemoryPool__total_bytes_allocated, 1}, 
+		{ "_arrow_MemoryPool__num_allocations", (DL_FUNC) &_arrow_MemoryPool__num_allocations, 1}, 
 		{ "_arrow_MemoryPool__backend_name", (DL_FUNC) &_arrow_MemoryPool__backend_name, 1}, 
 		{ "_arrow_supported_memory_backends", (DL_FUNC) &_arrow_supported_memory_backends, 0}, 
 		{ "_arrow_ipc___Message__body_length", (DL_FUNC) &_arrow_ipc___Message__body_length, 1}, 
@@ -6120,6 +6350,8 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_parquet___arrow___ArrowReaderProperties__set_read_dictionary", (DL_FUNC) &_arrow_parquet___arrow___ArrowReaderProperties__set_read_dictionary, 3}, 
 		{ "_arrow_parquet___arrow___ArrowReaderProperties__set_coerce_int96_timestamp_unit", (DL_FUNC) &_arrow_parquet___arrow___ArrowReaderProperties__set_coerce_int96_timestamp_unit, 2}, 
 		{ "_arrow_parquet___arrow___ArrowReaderProperties__get_coerce_int96_timestamp_unit", (DL_FUNC) &_arrow_parquet___arrow___ArrowReaderProperties__get_coerce_int96_timestamp_unit, 1}, 
+		{ "_arrow_parquet___arrow___ArrowReaderProperties__set_load_statistics", (DL_FUNC) &_arrow_parquet___arrow___ArrowReaderProperties__set_load_statistics, 2}, 
+		{ "_arrow_parquet___arrow___ArrowReaderProperties__get_load_statistics", (DL_FUNC) &_arrow_parquet___arrow___ArrowReaderProperties__get_load_statistics, 1}, 
 		{ "_arrow_parquet___arrow___FileReader__OpenFile", (DL_FUNC) &_arrow_parquet___arrow___FileReader__OpenFile, 3}, 
 		{ "_arrow_parquet___arrow___FileReader__ReadTable1", (DL_FUNC) &_arrow_parquet___arrow___FileReader__ReadTable1, 1}, 
 		{ "_arrow_parquet___arrow___FileReader__ReadTable2", (DL_FUNC) &_arrow_parquet___arrow___FileReader__ReadTable2, 2}, 
@@ -6138,7 +6370,9 @@ static const R_CallMethodDef CallEntries[] = {
 		{ "_arrow_parquet___ArrowWriterProperties___Builder__set_compression_levels", (DL_FUNC) &_arrow_parquet___ArrowWriterProperties___Builder__set_compression_levels, 3}, 
 		{ "_arrow_parquet___ArrowWriterProperties___Builder__set_use_dictionary", (DL_FUNC) &_arrow_parquet___ArrowWriterProperties___Builder__set_use_dictionary, 3}, 
 		{ "_arrow_parquet___ArrowWriterProperties___Builder__set_write_statistics", (DL_FUNC) &_arrow_parquet___ArrowWriterProperties___Builder__set_write_statistics, 3}, 
+		{ "_arrow_parquet___ArrowWriterProperties___Builder__set_write_page_index", (DL_FUNC) &_arrow_parquet___ArrowWriterProperties___Builder__set_write_page_index, 3}, 
 		{ "_arrow_parquet___ArrowWriterProperties___Builder__data_page_size", (DL_FUNC) &_arrow_parquet___ArrowWriterProperties___Builder__data_page_size, 2}, 
+		{ "_arrow_parquet___WriterProperties___Builder__enable_bloom_filter", (DL_FUNC) &_arrow_parquet___WriterProperties___Builder__enable_bloom_filter, 4}, 
 		{ "_arrow_parquet___WriterProperties___Builder__build", (DL_FUNC) &_arrow_parquet___WriterProperties___Builder__build, 1}, 
 		{ "_arrow_parquet___arrow___ParquetFileWriter__Open", (DL_FUNC) &_arrow_parquet___arrow___ParquetFileWriter__Open, 4}, 
 		{ "_arrow_parquet___arrow___FileWriter__WriteTable", (DL_FUNC) &_arrow_parquet___arrow___FileWriter__WriteTable, 3}, 
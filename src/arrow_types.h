@@ -70,6 +70,7 @@ namespace fs = ::arrow::fs;
 
 std::shared_ptr<arrow::RecordBatch> RecordBatch__from_arrays(SEXP, SEXP);
 arrow::MemoryPool* gc_memory_pool();
+std::shared_ptr<arrow::MemoryPool> MakeQueryMemoryPool(int64_t limit);
 arrow::compute::ExecContext* gc_context();
 
 #define VECTOR_PTR_RO(x) ((const SEXP*)DATAPTR_RO(x))
@@ -251,6 +252,8 @@ void Init_Altrep_classes(DllInfo* dll);
 SEXP MakeAltrepVector(const std::shared_ptr<ChunkedArray>& chunked_array);
 bool is_arrow_altrep(SEXP x);
 bool is_unmaterialized_arrow_altrep(SEXP x);
+// Whether the values of x were converted from those of its Array, e.g. float32 to double
+bool is_converted_arrow_altrep(SEXP x);
 std::shared_ptr<ChunkedArray> vec_to_arrow_altrep_bypass(SEXP);
 
 }  // namespace altrep
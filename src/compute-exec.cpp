@@ -22,6 +22,7 @@
 #include "./safe-call-into-r.h"
 
 #include <arrow/acero/exec_plan.h>
+#include <arrow/acero/query_context.h>
 #include <arrow/buffer.h>
 #include <arrow/compute/api.h>
 #include <arrow/compute/expression.h>
@@ -30,6 +31,7 @@
 #include <arrow/util/future.h>
 #include <arrow/util/thread_pool.h>
 
+#include <chrono>
 #include <iostream>
 #include <optional>
 
@@ -42,16 +44,24 @@ std::shared_ptr<compute::FunctionOptions> make_compute_options(std::string func_
 std::shared_ptr<arrow::KeyValueMetadata> strings_to_kvm(cpp11::strings metadata);
 
 // [[acero::export]]
-std::shared_ptr<acero::ExecPlan> ExecPlan_create(bool use_threads) {
-  static compute::ExecContext threaded_context{gc_memory_pool(),
-                                               arrow::internal::GetCpuThreadPool()};
-  // TODO(weston) using gc_context() in this way is deprecated.  Once ordering has
-  // been added we can probably entirely remove all reference to ExecPlan from R
-  // in favor of DeclarationToXyz
-  auto plan =
-      ValueOrStop(acero::ExecPlan::Make(use_threads ? &threaded_context : gc_context()));
-
-  return plan;
+std::shared_ptr<acero::ExecPlan> ExecPlan_create(bool use_threads, double memory_limit,
+                                                 double spill_memory_limit) {
+  // Each plan allocates from its own pool so that what it allocated can be told
+  // apart from everything else. The returned pointer keeps that pool alive too.
+  struct PlanAndPool {
+    std::shared_ptr<arrow::MemoryPool> pool;
+    std::shared_ptr<acero::ExecPlan> plan;
+  };
+  auto out = std::make_shared<PlanAndPool>();
+  out->pool = MakeQueryMemoryPool(static_cast<int64_t>(memory_limit));
+
+  compute::ExecContext context(
+      out->pool.get(), use_threads ? arrow::internal::GetCpuThreadPool() : nullptr);
+  acero::QueryOptions options;
+  options.spill_memory_limit = static_cast<int64_t>(spill_memory_limit);
+  out->plan = ValueOrStop(acero::ExecPlan::Make(options, context));
+
+  return std::shared_ptr<acero::ExecPlan>(out, out->plan.get());
 }
 
 std::shared_ptr<acero::ExecNode> MakeExecNodeOrStop(
@@ -73,16 +83,22 @@ std::shared_ptr<acero::ExecNode> MakeExecNodeOrStop(
 // while maintaining the ability for the entire plan to be executed at once
 // (e.g., to support user-defined functions) or never executed at all (e.g.,
 // to support printing a nested ExecPlan without having to execute it).
+//
+// Once started, the plan keeps producing into the sink node's queue while the
+// batches already there are being consumed. If the sink node was given a
+// backpressure limit, the plan pauses when that queue holds too many bytes.
 class ExecPlanReader : public arrow::RecordBatchReader {
  public:
   enum ExecPlanReaderStatus { PLAN_NOT_STARTED, PLAN_RUNNING, PLAN_FINISHED };
 
   ExecPlanReader(const std::shared_ptr<arrow::acero::ExecPlan>& plan,
                  const std::shared_ptr<arrow::Schema>& schema,
-                 arrow::AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen)
+                 arrow::AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen,
+                 acero::BackpressureMonitor* backpressure_monitor = nullptr)
       : schema_(schema),
         plan_(plan),
         sink_gen_(sink_gen),
+        backpressure_monitor_(backpressure_monitor),
         plan_status_(PLAN_NOT_STARTED),
         stop_token_(MainRThread::GetInstance().GetStopToken()) {}
 
@@ -123,7 +139,17 @@ class ExecPlanReader : public arrow::RecordBatchReader {
       return stop_token_.Poll();
     }
 
-    auto out = sink_gen_().result();
+    // A batch that is not queued yet means that the consumer is waiting on the plan
+    auto next = sink_gen_();
+    if (!next.is_finished()) {
+      auto start = std::chrono::steady_clock::now();
+      next.Wait();
+      stall_seconds_ +=
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      num_stalls_++;
+    }
+
+    auto out = next.result();
     if (!out.ok()) {
       StopProducing();
       return out.status();
@@ -137,6 +163,7 @@ class ExecPlanReader : public arrow::RecordBatchReader {
       }
 
       *batch_out = batch_result.ValueUnsafe();
+      num_batches_++;
     } else {
       batch_out->reset();
       plan_status_ = PLAN_FINISHED;
@@ -153,15 +180,35 @@ class ExecPlanReader : public arrow::RecordBatchReader {
 
   const std::shared_ptr<arrow::acero::ExecPlan>& Plan() const { return plan_; }
 
+  cpp11::list Stats() const {
+    // The monitor belongs to the sink node, which lives as long as plan_
+    bool has_queue = backpressure_monitor_ != nullptr;
+    double queued_bytes =
+        has_queue ? static_cast<double>(backpressure_monitor_->bytes_in_use()) : 0;
+    bool paused = has_queue && backpressure_monitor_->is_paused();
+
+    cpp11::writable::list out = {
+        cpp11::as_sexp(static_cast<double>(num_batches_)), cpp11::as_sexp(queued_bytes),
+        cpp11::as_sexp(paused), cpp11::as_sexp(static_cast<double>(num_stalls_)),
+        cpp11::as_sexp(stall_seconds_)};
+    out.names() = {"batches_read", "queued_bytes", "paused", "stalls", "stall_seconds"};
+    return out;
+  }
+
   ~ExecPlanReader() { StopProducing(); }
 
  private:
   std::shared_ptr<arrow::Schema> schema_;
   std::shared_ptr<arrow::acero::ExecPlan> plan_;
   arrow::AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen_;
+  acero::BackpressureMonitor* backpressure_monitor_;
   ExecPlanReaderStatus plan_status_;
   arrow::StopToken stop_token_;
 
+  int64_t num_batches_ = 0;
+  int64_t num_stalls_ = 0;
+  double stall_seconds_ = 0;
+
   void StartProducing() {
     plan_->StartProducing();
     plan_status_ = PLAN_RUNNING;
@@ -221,16 +268,45 @@ std::string ExecPlanReader__PlanStatus(const std::shared_ptr<ExecPlanReader>& re
   return reader->PlanStatus();
 }
 
+// [[acero::export]]
+cpp11::list ExecPlanReader__Stats(const std::shared_ptr<ExecPlanReader>& reader) {
+  return reader->Stats();
+}
+
+// [[acero::export]]
+cpp11::list ExecPlanReader__MemoryStats(const std::shared_ptr<ExecPlanReader>& reader) {
+  arrow::MemoryPool* pool = reader->Plan()->query_context()->memory_pool();
+
+  cpp11::writable::list out = {
+      cpp11::as_sexp(static_cast<double>(pool->bytes_allocated())),
+      cpp11::as_sexp(static_cast<double>(pool->max_memory())),
+      cpp11::as_sexp(static_cast<double>(pool->total_bytes_allocated())),
+      cpp11::as_sexp(static_cast<double>(pool->num_allocations()))};
+  out.names() = {"bytes_allocated", "max_memory", "total_bytes_allocated",
+                 "num_allocations"};
+  return out;
+}
+
 // [[acero::export]]
 std::shared_ptr<ExecPlanReader> ExecPlan_run(
     const std::shared_ptr<acero::ExecPlan>& plan,
-    const std::shared_ptr<acero::ExecNode>& final_node, cpp11::strings metadata) {
+    const std::shared_ptr<acero::ExecNode>& final_node, cpp11::strings metadata,
+    double max_queued_bytes) {
   // For now, don't require R to construct SinkNodes.
   // Instead, just pass the node we should collect as an argument.
   arrow::AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen;
 
-  MakeExecNodeOrStop("sink", plan.get(), {final_node.get()},
-                     acero::SinkNodeOptions{&sink_gen});
+  // The plan resumes once the consumer has drained half of the queue
+  acero::BackpressureOptions backpressure;
+  if (max_queued_bytes > 0) {
+    auto pause_if_above = static_cast<uint64_t>(max_queued_bytes);
+    backpressure = acero::BackpressureOptions(pause_if_above / 2, pause_if_above);
+  }
+  acero::BackpressureMonitor* backpressure_monitor = nullptr;
+
+  MakeExecNodeOrStop(
+      "sink", plan.get(), {final_node.get()},
+      acero::SinkNodeOptions{&sink_gen, backpressure, &backpressure_monitor});
 
   StopIfNotOk(plan->Validate());
 
@@ -241,7 +317,8 @@ std::shared_ptr<ExecPlanReader> ExecPlan_run(
     out_schema = out_schema->WithMetadata(kv);
   }
 
-  return std::make_shared<ExecPlanReader>(plan, out_schema, sink_gen);
+  return std::make_shared<ExecPlanReader>(plan, out_schema, sink_gen,
+                                          backpressure_monitor);
 }
 
 // [[acero::export]]
@@ -406,6 +483,36 @@ std::shared_ptr<acero::ExecNode> ExecNode_Aggregate(
       acero::AggregateNodeOptions{std::move(aggregates), std::move(keys)});
 }
 
+// [[acero::export]]
+std::shared_ptr<acero::ExecNode> ExecNode_Window(
+    const std::shared_ptr<acero::ExecNode>& input, cpp11::list options,
+    std::vector<std::string> key_names) {
+  std::vector<acero::WindowFunction> functions;
+
+  for (cpp11::list name_opts : options) {
+    auto function = cpp11::as_cpp<std::string>(name_opts["fun"]);
+    auto opts = make_compute_options(function, name_opts["options"]);
+    auto target_names = cpp11::as_cpp<std::vector<std::string>>(name_opts["targets"]);
+    auto name = cpp11::as_cpp<std::string>(name_opts["name"]);
+
+    std::vector<arrow::FieldRef> targets;
+    for (auto&& target : target_names) {
+      targets.emplace_back(std::move(target));
+    }
+    // Aggregates are computed over the whole group, as in dplyr::mutate()
+    functions.push_back(acero::WindowFunction{std::move(function), opts,
+                                              std::move(targets), std::move(name)});
+  }
+
+  std::vector<arrow::FieldRef> keys;
+  for (auto&& name : key_names) {
+    keys.emplace_back(std::move(name));
+  }
+  return MakeExecNodeOrStop(
+      "window", input->plan(), {input.get()},
+      acero::WindowNodeOptions{std::move(functions), std::move(keys)});
+}
+
 // [[acero::export]]
 std::shared_ptr<acero::ExecNode> ExecNode_Join(
     const std::shared_ptr<acero::ExecNode>& input, acero::JoinType join_type,
@@ -449,6 +556,65 @@ std::shared_ptr<acero::ExecNode> ExecNode_Join(
                                  std::move(output_suffix_for_right)});
 }
 
+// [[acero::export]]
+std::shared_ptr<acero::ExecNode> ExecNode_RangeJoin(
+    const std::shared_ptr<acero::ExecNode>& input, acero::JoinType join_type,
+    const std::shared_ptr<acero::ExecNode>& right_data,
+    std::vector<std::string> left_keys, std::vector<std::string> right_keys,
+    std::vector<std::string> condition_left, std::vector<std::string> condition_cmp,
+    std::vector<std::string> condition_right, std::vector<std::string> left_output,
+    std::vector<std::string> right_output, std::string output_suffix_for_left,
+    std::string output_suffix_for_right, bool na_matches) {
+  std::vector<arrow::FieldRef> left_refs, right_refs, left_out_refs, right_out_refs;
+  std::vector<acero::JoinKeyCmp> key_cmps;
+  for (auto&& name : left_keys) {
+    left_refs.emplace_back(std::move(name));
+    key_cmps.emplace_back(na_matches ? acero::JoinKeyCmp::IS : acero::JoinKeyCmp::EQ);
+  }
+  for (auto&& name : right_keys) {
+    right_refs.emplace_back(std::move(name));
+  }
+  std::vector<acero::JoinRangeCondition> conditions;
+  for (size_t i = 0; i < condition_cmp.size(); ++i) {
+    acero::JoinRangeCmp cmp;
+    if (condition_cmp[i] == "<") {
+      cmp = acero::JoinRangeCmp::LT;
+    } else if (condition_cmp[i] == "<=") {
+      cmp = acero::JoinRangeCmp::LE;
+    } else if (condition_cmp[i] == ">") {
+      cmp = acero::JoinRangeCmp::GT;
+    } else if (condition_cmp[i] == ">=") {
+      cmp = acero::JoinRangeCmp::GE;
+    } else {
+      cpp11::stop("Unsupported join condition '%s'", condition_cmp[i].c_str());
+    }
+    conditions.push_back(acero::JoinRangeCondition{arrow::FieldRef(condition_left[i]),
+                                                   cmp,
+                                                   arrow::FieldRef(condition_right[i])});
+  }
+  for (auto&& name : left_output) {
+    left_out_refs.emplace_back(std::move(name));
+  }
+  if (join_type != acero::JoinType::LEFT_SEMI &&
+      join_type != acero::JoinType::LEFT_ANTI) {
+    for (auto&& name : right_output) {
+      right_out_refs.emplace_back(std::move(name));
+    }
+  }
+
+  return MakeExecNodeOrStop(
+      "range_join", input->plan(), {input.get(), right_data.get()},
+      acero::RangeJoinNodeOptions{join_type,
+                                  std::move(left_refs),
+                                  std::move(right_refs),
+                                  std::move(conditions),
+                                  std::move(left_out_refs),
+                                  std::move(right_out_refs),
+                                  std::move(key_cmps),
+                                  std::move(output_suffix_for_left),
+                                  std::move(output_suffix_for_right)});
+}
+
 // [[acero::export]]
 std::shared_ptr<acero::ExecNode> ExecNode_Union(
     const std::shared_ptr<acero::ExecNode>& input,
@@ -465,12 +631,32 @@ std::shared_ptr<acero::ExecNode> ExecNode_Fetch(
 
 // [[acero::export]]
 std::shared_ptr<acero::ExecNode> ExecNode_OrderBy(
-    const std::shared_ptr<acero::ExecNode>& input, cpp11::list sort_options) {
+    const std::shared_ptr<acero::ExecNode>& input, cpp11::list sort_options,
+    double sort_run_length) {
+  auto sort = std::dynamic_pointer_cast<compute::SortOptions>(
+      make_compute_options("sort_indices", sort_options));
+  acero::OrderByNodeOptions options{sort->AsOrdering()};
+  // A negative run length keeps the default
+  if (sort_run_length >= 0) {
+    options.sort_run_length = static_cast<int64_t>(sort_run_length);
+  }
+  return MakeExecNodeOrStop("order_by", input->plan(), {input.get()}, options);
+}
+
+// [[acero::export]]
+std::shared_ptr<acero::ExecNode> ExecNode_TopK(
+    const std::shared_ptr<acero::ExecNode>& input, cpp11::list sort_options, int64_t k,
+    bool with_ties, std::vector<std::string> key_names) {
+  std::vector<arrow::FieldRef> keys;
+  for (auto&& name : key_names) {
+    keys.emplace_back(std::move(name));
+  }
   return MakeExecNodeOrStop(
-      "order_by", input->plan(), {input.get()},
-      acero::OrderByNodeOptions{std::dynamic_pointer_cast<compute::SortOptions>(
-                                    make_compute_options("sort_indices", sort_options))
-                                    ->AsOrdering()});
+      "top_k", input->plan(), {input.get()},
+      acero::TopKNodeOptions{std::dynamic_pointer_cast<compute::SortOptions>(
+                                 make_compute_options("sort_indices", sort_options))
+                                 ->AsOrdering(),
+                             k, with_ties, std::move(keys)});
 }
 
 // [[acero::export]]
@@ -250,6 +250,12 @@ std::shared_ptr<arrow::compute::FunctionOptions> make_compute_options(
     return out;
   }
 
+  // lag and lead are only computed by the window node
+  if (func_name == "lag" || func_name == "lead") {
+    using Options = arrow::compute::PairwiseOptions;
+    return std::make_shared<Options>(cpp11::as_cpp<int>(options["periods"]));
+  }
+
   if (func_name == "is_in" || func_name == "index_in") {
     using Options = arrow::compute::SetLookupOptions;
     return std::make_shared<Options>(cpp11::as_cpp<arrow::Datum>(options["value_set"]),
@@ -344,7 +344,8 @@ std::shared_ptr<ds::ParquetFragmentScanOptions>
 dataset___ParquetFragmentScanOptions__Make(bool use_buffered_stream, int64_t buffer_size,
                                            bool pre_buffer,
                                            int32_t thrift_string_size_limit,
-                                           int32_t thrift_container_size_limit) {
+                                           int32_t thrift_container_size_limit,
+                                           bool load_statistics) {
   auto options = std::make_shared<ds::ParquetFragmentScanOptions>();
   if (use_buffered_stream) {
     options->reader_properties->enable_buffered_stream();
@@ -360,9 +361,20 @@ dataset___ParquetFragmentScanOptions__Make(bool use_buffered_stream, int64_t buf
   options->reader_properties->set_thrift_string_size_limit(thrift_string_size_limit);
   options->reader_properties->set_thrift_container_size_limit(
       thrift_container_size_limit);
+  options->arrow_reader_properties->set_should_load_statistics(load_statistics);
   return options;
 }
 
+// [[dataset::export]]
+double dataset___GetParquetMetadataCacheCapacity() {
+  return static_cast<double>(ds::GetParquetMetadataCacheCapacity());
+}
+
+// [[dataset::export]]
+void dataset___SetParquetMetadataCacheCapacity(int64_t capacity) {
+  StopIfNotOk(ds::SetParquetMetadataCacheCapacity(capacity));
+}
+
 // DirectoryPartitioning, HivePartitioning
 
 ds::SegmentEncoding GetSegmentEncoding(const std::string& segment_encoding) {
@@ -59,6 +59,8 @@ const char* r6_class_name<arrow::DataType>::get(
       return "Utf8";
     case Type::LARGE_STRING:
       return "LargeUtf8";
+    case Type::STRING_VIEW:
+      return "Utf8View";
 
     case Type::BINARY:
       return "Binary";
@@ -168,6 +170,9 @@ std::shared_ptr<arrow::DataType> Utf8__initialize() { return arrow::utf8(); }
 // [[arrow::export]]
 std::shared_ptr<arrow::DataType> LargeUtf8__initialize() { return arrow::large_utf8(); }
 
+// [[arrow::export]]
+std::shared_ptr<arrow::DataType> Utf8View__initialize() { return arrow::utf8_view(); }
+
 // [[arrow::export]]
 std::shared_ptr<arrow::DataType> Binary__initialize() { return arrow::binary(); }
 
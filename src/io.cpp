@@ -260,6 +260,8 @@ class RConnectionFileInterface : public virtual arrow::io::FileInterface {
  protected:
   cpp11::sexp connection_sexp_;
 
+  bool seekable() const { return seekable_; }
+
   // Define the logic here because multiple inheritance makes it difficult
   // for this base class, the InputStream and the RandomAccessFile
   // interfaces to co-exist.
@@ -283,7 +285,7 @@ class RConnectionFileInterface : public virtual arrow::io::FileInterface {
 
           int64_t result_size = cpp11::safe[Rf_xlength](result);
           memcpy(out, cpp11::safe[RAW](result), result_size);
-          bytes_read_++;
+          bytes_read_ += result_size;
           return result_size;
         },
         "readBin() on R connection");
@@ -364,18 +366,147 @@ class RConnectionFileInterface : public virtual arrow::io::FileInterface {
   }
 };
 
+// Reads the connection in large blocks so that the many small reads issued by
+// e.g. the IPC and CSV readers are served from memory instead of each being a
+// readBin() call on the R thread. When reading from another thread, the next
+// block is requested as soon as the current one is in use, so that R reads it
+// while the current one is being processed.
+//
+// Only files, seekable connections, url() and gzcon() connections are read
+// ahead. Those end at the end of the file or download, so reading a block only
+// waits for data that is on its way. Reading a block from e.g. a socket or a
+// pipe can wait for data that the caller never asked for, so those are read
+// exactly as requested.
 class RConnectionInputStream : public virtual arrow::io::InputStream,
                                public RConnectionFileInterface {
  public:
+  static constexpr int64_t kBlockSize = 8 * 1024 * 1024;
+
   explicit RConnectionInputStream(cpp11::sexp connection_sexp)
-      : RConnectionFileInterface(connection_sexp) {}
+      : RConnectionFileInterface(connection_sexp),
+        read_ahead_(seekable() || Rf_inherits(connection_sexp, "file") ||
+                    Rf_inherits(connection_sexp, "gzfile") ||
+                    Rf_inherits(connection_sexp, "bzfile") ||
+                    Rf_inherits(connection_sexp, "xzfile") ||
+                    Rf_inherits(connection_sexp, "url") ||
+                    Rf_inherits(connection_sexp, "url-libcurl") ||
+                    Rf_inherits(connection_sexp, "url-wininet") ||
+                    Rf_inherits(connection_sexp, "gzcon")),
+        block_position_(0),
+        position_(0) {
+    auto position = RConnectionFileInterface::Tell();
+    if (position.ok()) {
+      position_ = position.ValueUnsafe();
+    }
+  }
+
+  // The connection itself is ahead of what has been read from the stream
+  arrow::Result<int64_t> Tell() const override {
+    if (closed()) {
+      return arrow::Status::IOError("R connection is closed");
+    }
+    return position_;
+  }
 
   arrow::Result<int64_t> Read(int64_t nbytes, void* out) override {
-    return ReadBase(nbytes, out);
+    if (closed()) {
+      return arrow::Status::IOError("R connection is closed");
+    }
+
+    if (!read_ahead_) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadBase(nbytes, out));
+      position_ += bytes_read;
+      return bytes_read;
+    }
+
+    auto* dest = static_cast<uint8_t*>(out);
+    int64_t total = 0;
+    while (total < nbytes) {
+      int64_t remaining = nbytes - total;
+
+      if (block_available() == 0) {
+        // Large reads go straight into `out` unless a block is already on its way
+        if (remaining >= kBlockSize && !prefetch_.is_valid()) {
+          ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadBase(remaining, dest + total));
+          total += bytes_read;
+          break;
+        }
+
+        ARROW_ASSIGN_OR_RAISE(bool has_data, NextBlock());
+        if (!has_data) {
+          break;
+        }
+      }
+
+      int64_t n = std::min(remaining, block_available());
+      memcpy(dest + total, block_->data() + block_position_, n);
+      block_position_ += n;
+      total += n;
+    }
+
+    position_ += total;
+    return total;
   }
 
   arrow::Result<std::shared_ptr<arrow::Buffer>> Read(int64_t nbytes) override {
-    return ReadBase(nbytes);
+    if (closed()) {
+      return arrow::Status::IOError("R connection is closed");
+    }
+
+    // Reads that fit in the current block are slices of it
+    if (nbytes <= block_available()) {
+      auto out = arrow::SliceBuffer(block_, block_position_, nbytes);
+      block_position_ += nbytes;
+      position_ += nbytes;
+      return out;
+    }
+
+    arrow::BufferBuilder builder;
+    RETURN_NOT_OK(builder.Reserve(nbytes));
+
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, builder.mutable_data()));
+    builder.UnsafeAdvance(bytes_read);
+    return builder.Finish();
+  }
+
+ private:
+  bool read_ahead_;
+  std::shared_ptr<arrow::Buffer> block_;
+  int64_t block_position_;
+  int64_t position_;
+  arrow::Future<std::shared_ptr<arrow::Buffer>> prefetch_;
+
+  int64_t block_available() const {
+    return block_ == nullptr ? 0 : block_->size() - block_position_;
+  }
+
+  // Makes the next block current, returning false at the end of the stream
+  arrow::Result<bool> NextBlock() {
+    auto next = std::move(prefetch_);
+    prefetch_ = arrow::Future<std::shared_ptr<arrow::Buffer>>();
+    if (!next.is_valid()) {
+      next = ReadBlockAsync();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(block_, next.result());
+    block_position_ = 0;
+
+    // A short block means that the end of the stream is near, so only read
+    // ahead after full ones. On the R thread there is nothing to overlap with.
+    MainRThread& main_r_thread = MainRThread::GetInstance();
+    if (block_->size() == kBlockSize && !main_r_thread.IsMainThread() &&
+        main_r_thread.CanExecuteSafeCallIntoR()) {
+      prefetch_ = ReadBlockAsync();
+    }
+
+    return block_->size() > 0;
+  }
+
+  arrow::Future<std::shared_ptr<arrow::Buffer>> ReadBlockAsync() {
+    // The task holds on to the stream in case it is dropped before the task runs
+    auto self = std::dynamic_pointer_cast<RConnectionInputStream>(shared_from_this());
+    return SafeCallIntoRAsync<std::shared_ptr<arrow::Buffer>>(
+        [self]() { return self->ReadBase(kBlockSize); }, "readBin() on R connection");
   }
 };
 
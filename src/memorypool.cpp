@@ -19,6 +19,8 @@
 #include "./arrow_types.h"
 #include "./safe-call-into-r.h"
 
+#include <atomic>
+
 class GcMemoryPool : public arrow::MemoryPool {
  public:
   GcMemoryPool() : pool_(arrow::default_memory_pool()) {}
@@ -77,6 +79,83 @@ static GcMemoryPool g_pool;
 
 arrow::MemoryPool* gc_memory_pool() { return &g_pool; }
 
+// The pool of one query: it allocates from gc_memory_pool() and keeps its own
+// count of what was allocated through it. With a limit, allocations that would
+// go over it fail with an OutOfMemory error, without calling gc() first.
+//
+// Buffers allocated by a query usually outlive it, so the pool only deletes
+// itself once its owner has let go of it and all of its buffers have been freed.
+class QueryMemoryPool : public arrow::MemoryPool {
+ public:
+  static std::shared_ptr<arrow::MemoryPool> Make(int64_t limit) {
+    return std::shared_ptr<arrow::MemoryPool>(
+        new QueryMemoryPool(limit), [](QueryMemoryPool* pool) { pool->Unref(); });
+  }
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  arrow::Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override {
+    refs_.fetch_add(1);
+    auto status = pool()->Allocate(size, alignment, out);
+    if (!status.ok()) {
+      Unref();
+    }
+    return status;
+  }
+
+  arrow::Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                           uint8_t** ptr) override {
+    return pool()->Reallocate(old_size, new_size, alignment, ptr);
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    pool()->Free(buffer, size, alignment);
+    Unref();
+  }
+
+  void ReleaseUnused() override { proxy_.ReleaseUnused(); }
+
+  int64_t bytes_allocated() const override { return proxy_.bytes_allocated(); }
+
+  int64_t max_memory() const override { return proxy_.max_memory(); }
+
+  int64_t total_bytes_allocated() const override {
+    return proxy_.total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return proxy_.num_allocations(); }
+
+  std::string backend_name() const override { return proxy_.backend_name(); }
+
+ private:
+  explicit QueryMemoryPool(int64_t limit) : proxy_(gc_memory_pool()), refs_(1) {
+    if (limit > 0) {
+      capped_ = std::make_unique<arrow::CappedMemoryPool>(&proxy_, limit);
+    }
+  }
+
+  arrow::MemoryPool* pool() {
+    return capped_ ? static_cast<arrow::MemoryPool*>(capped_.get()) : &proxy_;
+  }
+
+  // One reference for the owner and one for each live allocation
+  void Unref() {
+    if (refs_.fetch_sub(1) == 1) {
+      delete this;
+    }
+  }
+
+  arrow::ProxyMemoryPool proxy_;
+  std::unique_ptr<arrow::CappedMemoryPool> capped_;
+  std::atomic<int64_t> refs_;
+};
+
+std::shared_ptr<arrow::MemoryPool> MakeQueryMemoryPool(int64_t limit) {
+  return QueryMemoryPool::Make(limit);
+}
+
 // [[arrow::export]]
 std::shared_ptr<arrow::MemoryPool> MemoryPool__default() {
   return std::shared_ptr<arrow::MemoryPool>(&g_pool, [](...) {});
@@ -92,6 +171,16 @@ double MemoryPool__max_memory(const std::shared_ptr<arrow::MemoryPool>& pool) {
   return pool->max_memory();
 }
 
+// [[arrow::export]]
+double MemoryPool__total_bytes_allocated(const std::shared_ptr<arrow::MemoryPool>& pool) {
+  return pool->total_bytes_allocated();
+}
+
+// [[arrow::export]]
+double MemoryPool__num_allocations(const std::shared_ptr<arrow::MemoryPool>& pool) {
+  return pool->num_allocations();
+}
+
 // [[arrow::export]]
 std::string MemoryPool__backend_name(const std::shared_ptr<arrow::MemoryPool>& pool) {
   return pool->backend_name();
@@ -114,6 +114,19 @@ parquet___arrow___ArrowReaderProperties__get_coerce_int96_timestamp_unit(
   return properties->coerce_int96_timestamp_unit();
 }
 
+// [[parquet::export]]
+void parquet___arrow___ArrowReaderProperties__set_load_statistics(
+    const std::shared_ptr<parquet::ArrowReaderProperties>& properties,
+    bool load_statistics) {
+  properties->set_should_load_statistics(load_statistics);
+}
+
+// [[parquet::export]]
+bool parquet___arrow___ArrowReaderProperties__get_load_statistics(
+    const std::shared_ptr<parquet::ArrowReaderProperties>& properties) {
+  return properties->should_load_statistics();
+}
+
 // [[parquet::export]]
 std::shared_ptr<parquet::arrow::FileReader> parquet___arrow___FileReader__OpenFile(
     const std::shared_ptr<arrow::io::RandomAccessFile>& file,
@@ -334,6 +347,29 @@ void parquet___ArrowWriterProperties___Builder__set_write_statistics(
   }
 }
 
+// [[parquet::export]]
+void parquet___ArrowWriterProperties___Builder__set_write_page_index(
+    const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder,
+    const std::vector<std::string>& paths, cpp11::logicals write_page_index) {
+  auto n = write_page_index.size();
+  if (n == 1) {
+    if (write_page_index[0] == TRUE) {
+      builder->enable_write_page_index();
+    } else {
+      builder->disable_write_page_index();
+    }
+  } else {
+    builder->disable_write_page_index();
+    for (decltype(n) i = 0; i < n; i++) {
+      if (write_page_index[i] == TRUE) {
+        builder->enable_write_page_index(paths[i]);
+      } else {
+        builder->disable_write_page_index(paths[i]);
+      }
+    }
+  }
+}
+
 // [[parquet::export]]
 void parquet___ArrowWriterProperties___Builder__data_page_size(
     const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder,
@@ -341,6 +377,18 @@ void parquet___ArrowWriterProperties___Builder__data_page_size(
   builder->data_pagesize(data_page_size);
 }
 
+// [[parquet::export]]
+void parquet___WriterProperties___Builder__enable_bloom_filter(
+    const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder,
+    const std::vector<std::string>& paths, cpp11::integers ndv, cpp11::doubles fpp) {
+  for (size_t i = 0; i < paths.size(); i++) {
+    parquet::BloomFilterOptions options;
+    options.ndv = ndv[i];
+    options.fpp = fpp[i];
+    builder->enable_bloom_filter(paths[i], options);
+  }
+}
+
 // [[parquet::export]]
 std::shared_ptr<parquet::WriterProperties> parquet___WriterProperties___Builder__build(
     const std::shared_ptr<parquet::WriterPropertiesBuilder>& builder) {
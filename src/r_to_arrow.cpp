@@ -26,10 +26,14 @@
 #include <arrow/array/concatenate.h>
 #include <arrow/table.h>
 #include <arrow/type_traits.h>
+#include <arrow/util/binary_view_util.h>
 #include <arrow/util/bitmap_writer.h>
 #include <arrow/util/checked_cast.h>
 #include <arrow/util/converter.h>
 #include <arrow/util/logging.h>
+#include <arrow/util/thread_pool.h>
+
+#include <unordered_map>
 
 #include "./r_task_group.h"
 
@@ -442,10 +446,10 @@ class RPrimitiveConverter<
     if (ALTREP(x)) {
       // `x` is an ALTREP R vector storing `r_value_type`
       // and that type matches exactly the type of the array this is building
-      return Extend_impl(RVectorIterator_ALTREP<r_value_type>(x, offset), size);
+      return Extend_impl(RVectorIterator_ALTREP<r_value_type>(x, offset), size - offset);
     } else {
       // `x` is not an ALTREP vector so we have direct access to a range of values
-      return Extend_impl(RVectorIterator<r_value_type>(x, offset), size);
+      return Extend_impl(RVectorIterator<r_value_type>(x, offset), size - offset);
     }
   }
 
@@ -488,9 +492,9 @@ class RPrimitiveConverter<T, enable_if_t<is_boolean_type<T>::value>>
     }
 
     if (ALTREP(x)) {
-      return Extend_impl(RVectorIterator_ALTREP<cpp11::r_bool>(x, offset), size);
+      return Extend_impl(RVectorIterator_ALTREP<cpp11::r_bool>(x, offset), size - offset);
     } else {
-      return Extend_impl(RVectorIterator<cpp11::r_bool>(x, offset), size);
+      return Extend_impl(RVectorIterator<cpp11::r_bool>(x, offset), size - offset);
     }
   }
 
@@ -675,11 +679,11 @@ class RPrimitiveConverter<T, enable_if_t<is_time_type<T>::value>>
     };
 
     if (ALTREP(x)) {
-      return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size, append_null,
-                         append_value);
+      return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size - offset,
+                         append_null, append_value);
     } else {
-      return VisitVector(RVectorIterator<double>(x, offset), size, append_null,
-                         append_value);
+      return VisitVector(RVectorIterator<double>(x, offset), size - offset,
+                         append_null, append_value);
     }
   }
 
@@ -714,11 +718,11 @@ class RPrimitiveConverter<T, enable_if_t<is_timestamp_type<T>::value>>
     };
 
     if (ALTREP(x)) {
-      return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size, append_null,
-                         append_value);
+      return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size - offset,
+                         append_null, append_value);
     } else {
-      return VisitVector(RVectorIterator<double>(x, offset), size, append_null,
-                         append_value);
+      return VisitVector(RVectorIterator<double>(x, offset), size - offset,
+                         append_null, append_value);
     }
   }
 
@@ -754,20 +758,20 @@ class RPrimitiveConverter<T, enable_if_t<is_decimal_type<T>::value>>
     switch (TYPEOF(x)) {
       case REALSXP:
         if (ALTREP(x)) {
-          return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size, append_null,
-                             append_value);
+          return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size - offset,
+                             append_null, append_value);
         } else {
-          return VisitVector(RVectorIterator<double>(x, offset), size, append_null,
-                             append_value);
+          return VisitVector(RVectorIterator<double>(x, offset), size - offset,
+                             append_null, append_value);
         }
         break;
       case INTSXP:
         if (ALTREP(x)) {
-          return VisitVector(RVectorIterator_ALTREP<int>(x, offset), size, append_null,
-                             append_value);
+          return VisitVector(RVectorIterator_ALTREP<int>(x, offset), size - offset,
+                             append_null, append_value);
         } else {
-          return VisitVector(RVectorIterator<int>(x, offset), size, append_null,
-                             append_value);
+          return VisitVector(RVectorIterator<int>(x, offset), size - offset,
+                             append_null, append_value);
         }
         break;
       default:
@@ -818,7 +822,8 @@ class RPrimitiveConverter<T, enable_if_binary<T>>
       this->primitive_builder_->UnsafeAppend(RAW_RO(raw), static_cast<OffsetType>(n));
       return Status::OK();
     };
-    return VisitVector(RVectorIterator<SEXP>(x, offset), size, append_null, append_value);
+    return VisitVector(RVectorIterator<SEXP>(x, offset), size - offset,
+                       append_null, append_value);
   }
 
   void DelayedExtend(SEXP values, int64_t size, RTasks& tasks) override {
@@ -850,7 +855,8 @@ class RPrimitiveConverter<T, enable_if_t<std::is_same<T, FixedSizeBinaryType>::v
       this->primitive_builder_->UnsafeAppend(RAW_RO(raw));
       return Status::OK();
     };
-    return VisitVector(RVectorIterator<SEXP>(x, offset), size, append_null, append_value);
+    return VisitVector(RVectorIterator<SEXP>(x, offset), size - offset,
+                       append_null, append_value);
   }
 
   void DelayedExtend(SEXP values, int64_t size, RTasks& tasks) override {
@@ -881,8 +887,8 @@ class RPrimitiveConverter<T, enable_if_string_like<T>>
 
  private:
   Status UnsafeAppendUtf8Strings(const cpp11::strings& s, int64_t size, int64_t offset) {
-    RETURN_NOT_OK(this->primitive_builder_->Reserve(s.size()));
-    const SEXP* p_strings = reinterpret_cast<const SEXP*>(DATAPTR_RO(s));
+    RETURN_NOT_OK(this->primitive_builder_->Reserve(size - offset));
+    const SEXP* p_strings = reinterpret_cast<const SEXP*>(DATAPTR_RO(s)) + offset;
 
     // we know all the R strings are utf8 already, so we can get
     // a definite size and then use UnsafeAppend*()
@@ -894,7 +900,7 @@ class RPrimitiveConverter<T, enable_if_string_like<T>>
     RETURN_NOT_OK(this->primitive_builder_->ReserveData(total_length));
 
     // append
-    p_strings = reinterpret_cast<const SEXP*>(DATAPTR_RO(s));
+    p_strings = reinterpret_cast<const SEXP*>(DATAPTR_RO(s)) + offset;
     for (R_xlen_t i = offset; i < size; i++, ++p_strings) {
       SEXP si = *p_strings;
       if (si == NA_STRING) {
@@ -908,6 +914,150 @@ class RPrimitiveConverter<T, enable_if_string_like<T>>
   }
 };
 
+// A Buffer over the bytes of a CHARSXP, which it keeps alive
+class RCharsxpBuffer : public Buffer {
+ public:
+  explicit RCharsxpBuffer(SEXP s)
+      : Buffer(reinterpret_cast<const uint8_t*>(CHAR(s)), LENGTH(s),
+               arrow::CPUDevice::memory_manager(gc_memory_pool())),
+        s_(s) {}
+
+ private:
+  cpp11::sexp s_;
+};
+
+// A binary view builder that can also append views of CHARSXPs without
+// copying them: each CHARSXP becomes one more data buffer of the array, after
+// the ones the builder filled itself.
+template <typename BuilderType>
+class RBinaryViewBuilder : public BuilderType {
+ public:
+  using BuilderType::BuilderType;
+  using c_type = BinaryViewType::c_type;
+
+  Status AppendCharsxp(SEXP s) {
+    ARROW_RETURN_NOT_OK(this->Reserve(1));
+
+    // the same CHARSXP is only referenced once, however many times it is used
+    auto inserted =
+        buffer_index_.emplace(s, static_cast<int32_t>(charsxp_buffers_.size()));
+    if (inserted.second) {
+      charsxp_buffers_.push_back(std::make_shared<RCharsxpBuffer>(s));
+    }
+
+    // the buffer index is relative to charsxp_buffers_ until FinishInternal()
+    charsxp_views_.push_back(this->length());
+    this->UnsafeAppendToBitmap(true);
+    this->data_builder_.UnsafeAppend(
+        util::ToNonInlineBinaryView(CHAR(s), LENGTH(s), inserted.first->second, 0));
+    return Status::OK();
+  }
+
+  void Reset() override {
+    BuilderType::Reset();
+    charsxp_buffers_.clear();
+    charsxp_views_.clear();
+    buffer_index_.clear();
+  }
+
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
+    // BuilderType::FinishInternal() calls Reset()
+    BufferVector charsxp_buffers = std::move(charsxp_buffers_);
+    std::vector<int64_t> charsxp_views = std::move(charsxp_views_);
+    ARROW_RETURN_NOT_OK(BuilderType::FinishInternal(out));
+
+    ArrayData* data = out->get();
+    auto num_heap_buffers = static_cast<int32_t>(data->buffers.size() - 2);
+    if (!charsxp_views.empty()) {
+      c_type* views = data->GetMutableValues<c_type>(1);
+      for (int64_t i : charsxp_views) {
+        views[i].ref.buffer_index += num_heap_buffers;
+      }
+    }
+    data->buffers.insert(data->buffers.end(), charsxp_buffers.begin(),
+                         charsxp_buffers.end());
+    return Status::OK();
+  }
+
+ private:
+  BufferVector charsxp_buffers_;
+  std::vector<int64_t> charsxp_views_;
+  std::unordered_map<SEXP, int32_t> buffer_index_;
+};
+
+template <typename T>
+class RPrimitiveConverter<T, enable_if_binary_view_like<T>>
+    : public PrimitiveConverter<T, RConverter> {
+ public:
+  using BuilderType = RBinaryViewBuilder<typename TypeTraits<T>::BuilderType>;
+
+  // Strings at least this long are referenced in place rather than copied.
+  // Shorter ones are cheaper to copy than to hold on to one by one.
+  static constexpr int kMinCharsxpViewSize = 4096;
+
+  Status Extend(SEXP x, int64_t size, int64_t offset = 0) override {
+    RVectorType rtype = GetVectorType(x);
+    if (rtype == STRING) {
+      return AppendUtf8Strings(arrow::r::utf8_strings(x), size, offset);
+    }
+    if (rtype == BINARY && std::is_same<T, BinaryViewType>::value) {
+      return AppendRaws(x, size, offset);
+    }
+    return Status::Invalid("Expecting a character vector");
+  }
+
+  void DelayedExtend(SEXP values, int64_t size, RTasks& tasks) override {
+    // RCharsxpBuffer preserves the CHARSXPs, which must happen on the main thread
+    auto task = [this, values, size]() { return this->Extend(values, size); };
+    tasks.Append(false, std::move(task));
+  }
+
+ protected:
+  Status Init(MemoryPool* pool) override {
+    RETURN_NOT_OK((PrimitiveConverter<T, RConverter>::Init(pool)));
+    this->builder_ = std::make_shared<BuilderType>(pool);
+    this->primitive_builder_ = view_builder_ =
+        checked_cast<BuilderType*>(this->builder_.get());
+    return Status::OK();
+  }
+
+ private:
+  Status AppendUtf8Strings(const cpp11::strings& s, int64_t size, int64_t offset) {
+    RETURN_NOT_OK(this->Reserve(size - offset));
+    const SEXP* p_strings = reinterpret_cast<const SEXP*>(DATAPTR_RO(s)) + offset;
+
+    for (R_xlen_t i = offset; i < size; i++, ++p_strings) {
+      SEXP si = *p_strings;
+      if (si == NA_STRING) {
+        view_builder_->UnsafeAppendNull();
+      } else if (LENGTH(si) >= kMinCharsxpViewSize) {
+        RETURN_NOT_OK(view_builder_->AppendCharsxp(si));
+      } else {
+        RETURN_NOT_OK(view_builder_->Append(CHAR(si), LENGTH(si)));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status AppendRaws(SEXP x, int64_t size, int64_t offset) {
+    RETURN_NOT_OK(this->Reserve(size - offset));
+    RETURN_NOT_OK(check_binary(x, size));
+
+    auto append_null = [this]() {
+      view_builder_->UnsafeAppendNull();
+      return Status::OK();
+    };
+
+    auto append_value = [this](SEXP raw) {
+      return view_builder_->Append(RAW_RO(raw), XLENGTH(raw));
+    };
+    return VisitVector(RVectorIterator<SEXP>(x, offset), size - offset,
+                       append_null, append_value);
+  }
+
+  BuilderType* view_builder_;
+};
+
 template <typename T>
 class RPrimitiveConverter<T, enable_if_t<is_duration_type<T>::value>>
     : public PrimitiveConverter<T, RConverter> {
@@ -935,11 +1085,11 @@ class RPrimitiveConverter<T, enable_if_t<is_duration_type<T>::value>>
       };
 
       if (ALTREP(x)) {
-        return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size, append_null,
-                           append_value);
+        return VisitVector(RVectorIterator_ALTREP<double>(x, offset), size - offset,
+                           append_null, append_value);
       } else {
-        return VisitVector(RVectorIterator<double>(x, offset), size, append_null,
-                           append_value);
+        return VisitVector(RVectorIterator<double>(x, offset), size - offset,
+                           append_null, append_value);
       }
 
       return Status::OK();
@@ -1055,15 +1205,10 @@ struct RConverterTrait;
 template <typename T>
 struct RConverterTrait<
     T, enable_if_t<!is_nested_type<T>::value && !is_interval_type<T>::value &&
-                   !is_extension_type<T>::value && !is_binary_view_like_type<T>::value>> {
+                   !is_extension_type<T>::value>> {
   using type = RPrimitiveConverter<T>;
 };
 
-template <typename T>
-struct RConverterTrait<T, enable_if_binary_view_like<T>> {
-  // not implemented
-};
-
 template <typename T>
 struct RConverterTrait<T, enable_if_list_like<T>> {
   using type = RListConverter<T>;
@@ -1092,7 +1237,8 @@ class RListConverter : public ListConverter<T, RConverter, RConverterTrait> {
       return this->value_converter_.get()->Extend(value, n);
     };
 
-    return VisitVector(RVectorIterator<SEXP>(x, offset), size, append_null, append_value);
+    return VisitVector(RVectorIterator<SEXP>(x, offset), size - offset,
+                       append_null, append_value);
   }
 
   void DelayedExtend(SEXP values, int64_t size, RTasks& tasks) override {
@@ -1439,6 +1585,100 @@ bool vector_from_r_memory(SEXP x, const std::shared_ptr<DataType>& type,
   return false;
 }
 
+// Converts a vector with one converter per range of values, so that the
+// ranges are converted in parallel, each into its own chunk.
+class RChunkedConverter : public RConverter {
+ public:
+  static Result<std::unique_ptr<RConverter>> Make(const RConversionOptions& options,
+                                                  int num_chunks, MemoryPool* pool) {
+    std::unique_ptr<RChunkedConverter> converter(new RChunkedConverter());
+    RETURN_NOT_OK(converter->Construct(options.type, options, pool));
+
+    int64_t chunk_size = bit_util::CeilDiv(options.size, num_chunks);
+    for (int64_t begin = 0; begin < options.size; begin += chunk_size) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk_converter,
+                            (MakeConverter<RConverter, RConverterTrait>(options.type,
+                                                                        options, pool)));
+      converter->converters_.push_back(std::move(chunk_converter));
+      converter->offsets_.push_back(begin);
+    }
+    converter->offsets_.push_back(options.size);
+
+    return std::unique_ptr<RConverter>(std::move(converter));
+  }
+
+  Status Extend(SEXP values, int64_t size, int64_t offset = 0) override {
+    for (size_t i = 0; i < converters_.size(); i++) {
+      RETURN_NOT_OK(converters_[i]->Extend(values, offsets_[i + 1], offsets_[i]));
+    }
+    return Status::OK();
+  }
+
+  void DelayedExtend(SEXP values, int64_t size, RTasks& tasks) override {
+    for (size_t i = 0; i < converters_.size(); i++) {
+      auto converter = converters_[i].get();
+      auto begin = offsets_[i];
+      auto end = offsets_[i + 1];
+      tasks.Append(true, [converter, values, begin, end]() {
+        return converter->Extend(values, end, begin);
+      });
+    }
+  }
+
+  Result<std::shared_ptr<ChunkedArray>> ToChunkedArray() override {
+    ArrayVector chunks;
+    for (auto& converter : converters_) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, converter->ToArray());
+      chunks.push_back(std::move(chunk));
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), type_);
+  }
+
+ private:
+  RChunkedConverter() = default;
+
+  std::vector<std::unique_ptr<RConverter>> converters_;
+
+  // converters_[i] converts the values from offsets_[i] to offsets_[i + 1]
+  std::vector<int64_t> offsets_;
+};
+
+// Vectors shorter than this are always converted in one go
+constexpr int64_t kMinParallelChunkSize = 1 << 20;
+
+// How many chunks to convert `x` into, in parallel: more than one only for
+// large vectors whose conversion only reads their data, when there are fewer
+// columns than threads to convert them.
+int NumParallelChunks(SEXP x, const DataType& type, int num_columns) {
+  if (ALTREP(x)) {
+    return 1;
+  }
+
+  switch (type.id()) {
+    case Type::BOOL:
+    case Type::INT8:
+    case Type::UINT8:
+    case Type::INT16:
+    case Type::UINT16:
+    case Type::INT32:
+    case Type::UINT32:
+    case Type::INT64:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIMESTAMP:
+      break;
+    default:
+      return 1;
+  }
+
+  int64_t max_chunks = XLENGTH(x) / kMinParallelChunkSize;
+  int64_t num_chunks = GetCpuThreadPoolCapacity() / std::max(num_columns, 1);
+  return static_cast<int>(std::max<int64_t>(std::min(num_chunks, max_chunks), 1));
+}
+
 }  // namespace r
 }  // namespace arrow
 
@@ -1498,6 +1738,13 @@ std::shared_ptr<arrow::Table> Table__from_dots(SEXP lst, SEXP schema_sxp,
   auto flatten_lst = arrow::r::FlattenDots(lst, num_fields);
   std::vector<std::unique_ptr<arrow::r::RConverter>> converters(num_fields);
 
+  // short circuit if `x` is an altrep vector that shells a chunked Array of the
+  // field's type. Otherwise its values are converted like those of any R vector.
+  auto altrep_matches_field = [&](SEXP x, int j) {
+    auto maybe = arrow::r::altrep::vec_to_arrow_altrep_bypass(x);
+    return maybe.get() && maybe->type()->Equals(schema->field(j)->type());
+  };
+
   // init converters
   for (int j = 0; j < num_fields && status.ok(); j++) {
     SEXP x = flatten_lst[j];
@@ -1507,7 +1754,7 @@ std::shared_ptr<arrow::Table> Table__from_dots(SEXP lst, SEXP schema_sxp,
     } else if (Rf_inherits(x, "Array")) {
       columns[j] = std::make_shared<arrow::ChunkedArray>(
           cpp11::as_cpp<std::shared_ptr<arrow::Array>>(x));
-    } else if (arrow::r::altrep::is_unmaterialized_arrow_altrep(x)) {
+    } else if (altrep_matches_field(x, j)) {
       columns[j] = arrow::r::altrep::vec_to_arrow_altrep_bypass(x);
     } else {
       arrow::r::RConversionOptions options;
@@ -1525,10 +1772,15 @@ std::shared_ptr<arrow::Table> Table__from_dots(SEXP lst, SEXP schema_sxp,
           continue;
         }
 
-        // otherwise go through the Converter API
+        // otherwise go through the Converter API, in parallel chunks for large
+        // columns when there are threads to spare
+        int num_chunks =
+            use_threads ? arrow::r::NumParallelChunks(x, *options.type, num_fields) : 1;
         auto converter_result =
-            arrow::MakeConverter<arrow::r::RConverter, arrow::r::RConverterTrait>(
-                options.type, options, gc_memory_pool());
+            num_chunks > 1
+                ? arrow::r::RChunkedConverter::Make(options, num_chunks, gc_memory_pool())
+                : arrow::MakeConverter<arrow::r::RConverter, arrow::r::RConverterTrait>(
+                      options.type, options, gc_memory_pool());
         if (converter_result.ok()) {
           converter = std::move(converter_result.ValueUnsafe());
         } else {
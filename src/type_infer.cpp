@@ -185,7 +185,10 @@ std::shared_ptr<arrow::DataType> InferArrowTypeFromVector<VECSXP>(SEXP x) {
 }
 
 std::shared_ptr<arrow::DataType> InferArrowType(SEXP x) {
-  if (arrow::r::altrep::is_unmaterialized_arrow_altrep(x)) {
+  // Vectors whose values were converted from those of their Array, e.g. float32 to
+  // double, get the type inferred for the R vector they are
+  if (arrow::r::altrep::is_unmaterialized_arrow_altrep(x) &&
+      !arrow::r::altrep::is_converted_arrow_altrep(x)) {
     return arrow::r::altrep::vec_to_arrow_altrep_bypass(x)->type();
   }
 
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <forward_list>
 #include <mutex>
 #include <sstream>
@@ -30,6 +31,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -38,6 +40,7 @@
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
@@ -60,6 +63,14 @@
 // keys. When a segment group end is reached while scanning the input, output is pushed
 // and the accumulating state is cleared. If no segment-keys are given, then the entire
 // input is taken as one segment group. One batch per segment group is sent to output.
+//
+// Without segment-keys every thread aggregates into its own grouper and kernel states.
+// When there are many groups, these thread-local states are merged by splitting the
+// key space into partitions: each partition gets its own grouper, and the partitions
+// and then the aggregates are merged in parallel. If the estimated size of the
+// thread-local states exceeds QueryOptions::spill_memory_limit, rows whose key is not
+// already held by their thread are partitioned the same way and written to disk, and
+// each partition is aggregated on its own after the in-memory states were merged.
 
 namespace arrow {
 
@@ -176,7 +187,8 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
         aggs_(std::move(aggs)),
         kernels_(std::move(kernels)),
         kernel_intypes_(std::move(kernel_intypes)),
-        states_(std::move(states)) {}
+        states_(std::move(states)),
+        thread_consumed_(plan->query_context()->max_concurrency(), false) {}
 
   static Result<AggregateNodeArgs<ScalarAggregateKernel>> MakeAggregateNodeArgs(
       const std::shared_ptr<Schema>& input_schema, const std::vector<FieldRef>& keys,
@@ -217,6 +229,14 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
 
   Status OutputResult(bool is_last);
 
+  // Merges the states at merge_threads_[j + stride] into those at merge_threads_[j],
+  // for every multiple j of 2 * stride, as parallel tasks.  The last task to finish
+  // starts the next level, so the per-thread states are merged as a tree.
+  Status MergeLevel(size_t stride);
+
+  // Finalizes the states at merge_threads_[0] and outputs them
+  Status FinalizeAndOutput(bool is_last);
+
   // A segmenter for the segment-keys
   std::unique_ptr<RowSegmenter> segmenter_;
   // Field indices corresponding to the segment-keys
@@ -232,6 +252,12 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
   // Input type holders for each kernel, used for state initialization
   std::vector<std::vector<TypeHolder>> kernel_intypes_;
   std::vector<std::vector<std::unique_ptr<KernelState>>> states_;
+  // Whether the states of each thread index have consumed any input (written only
+  // by the thread with that index)
+  std::vector<uint8_t> thread_consumed_;
+  // Thread indices of the states being merged, and the merges left at this level
+  std::vector<size_t> merge_threads_;
+  std::atomic<int> pending_merges_{0};
 
   AtomicCounter input_counter_;
   /// \brief Total number of output batches produced
@@ -276,6 +302,8 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   Status Merge();
 
+  Status StartPartitionedMerge();
+
   Result<ExecBatch> Finalize();
 
   Status OutputNthBatch(int64_t n);
@@ -311,8 +339,27 @@ class GroupByNode : public ExecNode, public TracedNode {
   struct ThreadLocalState {
     std::unique_ptr<Grouper> grouper;
     std::vector<std::unique_ptr<KernelState>> agg_states;
+    /// \brief Number of groups already included in in_memory_bytes_
+    uint32_t num_groups_accounted = 0;
+  };
+
+  /// \brief The groups of one thread-local state, split up by partition
+  struct MergeSource {
+    size_t state_index;
+    ExecBatch uniques;
+    std::vector<uint8_t> partition_of_group;
+    /// \brief Group ids sorted by partition, partition p is at
+    /// [partition_ranges[p], partition_ranges[p + 1])
+    std::vector<uint32_t> groups_by_partition;
+    std::vector<int64_t> partition_ranges;
+    /// \brief Maps each group to its group in the merged state
+    std::vector<uint32_t> transposition;
   };
 
+  static constexpr int kNumPartitions = HashPartitionedSpill::kNumPartitions;
+  /// \brief Below this many groups the thread-local states are merged serially
+  static constexpr int64_t kMinGroupsForPartitionedMerge = 64 * 1024;
+
   ThreadLocalState* GetLocalState() {
     size_t thread_index = plan_->query_context()->GetThreadIndex();
     return &local_states_[thread_index];
@@ -320,6 +367,38 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   Status InitLocalStateIfNeeded(ThreadLocalState* state);
 
+  Status ConsumeAggregates(const ExecSpan& batch, const ArrayData& group_ids,
+                           uint32_t num_groups,
+                           std::vector<std::unique_ptr<KernelState>>* agg_states);
+
+  Status ConsumeSpilling(size_t thread_index, ThreadLocalState* state,
+                         const ExecSpan& batch);
+
+  Status AccountForNewGroups(ThreadLocalState* state);
+
+  Status StartSpilling();
+
+  bool UsePartitionedMerge() const;
+
+  Status PartitionUniques(int64_t source_index);
+
+  Status MergePartition(int64_t partition);
+
+  Status OnPartitionsMerged();
+
+  Status MergeAggregate(int64_t kernel_index);
+
+  Status OnAggregatesMerged();
+
+  Result<ExecBatch> MergedKeys();
+
+  Status ProcessSpilledPartition(int partition);
+
+  Result<ExecBatch> FinalizeStates(ExecBatch keys,
+                                   std::vector<std::unique_ptr<KernelState>>* agg_states);
+
+  Status OutputBatches(const ExecBatch& batch);
+
   int output_batch_size() const {
     int result =
         static_cast<int>(plan_->query_context()->exec_context()->exec_chunksize());
@@ -350,6 +429,27 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  // Partitioned merge of the thread-local states
+  std::vector<TypeHolder> key_types_;
+  bool can_partition_keys_ = false;
+  int partition_uniques_task_group_id_;
+  int merge_partition_task_group_id_;
+  int merge_aggregate_task_group_id_;
+  std::vector<MergeSource> merge_sources_;
+  std::vector<std::unique_ptr<Grouper>> merged_groupers_;
+  std::vector<uint32_t> merged_partition_offsets_;
+  std::vector<std::unique_ptr<KernelState>> merged_states_;
+  uint32_t merged_num_groups_ = 0;
+
+  // Spilling, see QueryOptions::spill_memory_limit
+  int64_t spill_memory_limit_ = 0;
+  int64_t bytes_per_group_ = 0;
+  std::atomic<int64_t> in_memory_bytes_{0};
+  std::mutex spill_mutex_;
+  std::atomic<bool> spilling_{false};
+  std::unique_ptr<arrow::internal::TemporaryDir> spill_dir_;
+  HashPartitionedSpill spill_;
 };
 
 }  // namespace aggregate
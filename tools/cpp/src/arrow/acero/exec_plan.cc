@@ -472,6 +472,8 @@ const Ordering& ExecNode::ordering() const {
   return Ordering::Unordered();
 }
 
+Result<bool> ExecNode::PushRuntimeFilter(const RuntimeFilter& filter) { return false; }
+
 Status ExecNode::Init() { return Status::OK(); }
 
 Status ExecNode::Validate() const {
@@ -1118,6 +1120,9 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterHashJoinNode(this);
       internal::RegisterAsofJoinNode(this);
       internal::RegisterSortedMergeNode(this);
+      internal::RegisterWindowNode(this);
+      internal::RegisterTopKNode(this);
+      internal::RegisterRangeJoinNode(this);
     }
 
     Result<Factory> GetFactory(const std::string& factory_name) override {
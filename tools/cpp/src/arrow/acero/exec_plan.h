@@ -202,6 +202,18 @@ class ARROW_ACERO_EXPORT ExecNode {
   /// maintain continuity.
   virtual const Ordering& ordering() const;
 
+  /// \brief Offer a filter on this node's output that was learned at runtime
+  ///
+  /// A hash join calls this on its probe input once it has seen its whole build side.
+  /// Rows that do not pass `filter` cannot contribute to the plan's output.  Nodes
+  /// that keep rows intact (e.g. filter and project) forward the filter to their
+  /// input, and sources that can use it to skip data keep it.  By default the filter
+  /// is ignored.
+  ///
+  /// This may be called at any time after StartProducing(), concurrently with
+  /// InputReceived.  Returns true if some node kept the filter.
+  virtual Result<bool> PushRuntimeFilter(const RuntimeFilter& filter);
+
   /// Upstream API:
   /// These functions are called by input nodes that want to inform this node
   /// about an updated condition (a new input batch or an impending
@@ -602,6 +614,28 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// If this field is not set then it will be treated as kWarn unless overridden
   /// by the ACERO_ALIGNMENT_HANDLING environment variable
   std::optional<UnalignedBufferHandling> unaligned_buffer_handling;
+
+  /// \brief Memory budget for nodes that can spill their state to disk
+  ///
+  /// If this is greater than zero then nodes which accumulate their input write
+  /// parts of it to temporary files once they hold more than this many bytes:
+  ///
+  /// - the hash join partitions both of its inputs on the join keys and joins the
+  ///   partitions one at a time
+  /// - the order_by node sorts what it holds into a run, writes the run out and
+  ///   merges all runs once its input has finished (sort keys must be top-level
+  ///   fields of a primitive, temporal, decimal or binary-like type)
+  /// - the group-by aggregate node stops creating groups in memory; rows of other
+  ///   groups are partitioned on the keys and aggregated one partition at a time
+  ///   once the input has finished (not with segment keys, ordered aggregates or
+  ///   dictionary keys).  The size of the aggregate state is estimated from the
+  ///   number of groups.
+  ///
+  /// The files are created in the system temporary directory (e.g. TMPDIR).  Each
+  /// node applies the budget on its own.
+  ///
+  /// If this is zero (the default) then nothing is ever spilled.
+  int64_t spill_memory_limit = 0;
 };
 
 /// \brief Calculate the output schema of a declaration
@@ -33,5 +33,8 @@ void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
 void RegisterSortedMergeNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
+void RegisterTopKNode(ExecFactoryRegistry*);
+void RegisterRangeJoinNode(ExecFactoryRegistry*);
 
 }  // namespace arrow::acero::internal
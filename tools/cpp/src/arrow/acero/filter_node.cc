@@ -71,6 +71,10 @@ class FilterNode : public MapNode {
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  Result<bool> PushRuntimeFilter(const RuntimeFilter& filter) override {
+    return inputs_[0]->PushRuntimeFilter(filter);
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
     ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
                           SimplifyWithGuarantee(filter_, batch.guarantee));
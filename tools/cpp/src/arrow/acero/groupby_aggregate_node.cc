@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
@@ -27,8 +29,13 @@
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/datum.h"
@@ -47,6 +54,7 @@ using compute::ExecValue;
 using compute::Function;
 using compute::FunctionOptions;
 using compute::Grouper;
+using compute::Hashing32;
 using compute::HashAggregateKernel;
 using compute::Kernel;
 using compute::KernelContext;
@@ -55,14 +63,120 @@ using compute::KernelState;
 using compute::RowSegmenter;
 using compute::ScalarAggregateKernel;
 using compute::Segment;
+using compute::TakeOptions;
 
 namespace acero {
 namespace aggregate {
 
+namespace {
+
+// Wraps the uint32 values of a vector, which must outlive the result, in an array
+std::shared_ptr<ArrayData> WrapUInt32(const uint32_t* values, int64_t length) {
+  return ArrayData::Make(uint32(), length,
+                         {nullptr, Buffer::Wrap(values, static_cast<size_t>(length))});
+}
+
+Result<ExecBatch> TakeRows(const ExecBatch& batch, const Datum& indices,
+                           ExecContext* ctx) {
+  ExecBatch out({}, indices.length());
+  out.values.reserve(batch.values.size());
+  for (const Datum& value : batch.values) {
+    if (value.is_scalar()) {
+      out.values.push_back(value);
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum taken,
+                          Take(value, indices, TakeOptions::NoBoundsCheck(), ctx));
+    out.values.push_back(std::move(taken));
+  }
+  return out;
+}
+
+ExecSpan SelectColumns(const ExecSpan& batch, const std::vector<int>& column_ids) {
+  std::vector<ExecValue> values(column_ids.size());
+  for (size_t i = 0; i < column_ids.size(); ++i) {
+    values[i] = batch[column_ids[i]];
+  }
+  return ExecSpan(std::move(values), batch.length);
+}
+
+// The rows of a batch whose key Grouper::Lookup found, with their group ids, and the
+// rows whose key it did not find
+struct LookupResult {
+  std::shared_ptr<Array> found_rows;
+  std::shared_ptr<Array> found_ids;
+  std::shared_ptr<Array> missing_rows;
+};
+
+Result<LookupResult> SplitByLookup(const ArrayData& ids, uint32_t id_offset,
+                                   MemoryPool* pool) {
+  UInt32Builder found_rows(pool), found_ids(pool), missing_rows(pool);
+  int64_t num_found = ids.length - ids.GetNullCount();
+  RETURN_NOT_OK(found_rows.Reserve(num_found));
+  RETURN_NOT_OK(found_ids.Reserve(num_found));
+  RETURN_NOT_OK(missing_rows.Reserve(ids.length - num_found));
+  const uint32_t* id_values = ids.GetValues<uint32_t>(1);
+  for (int64_t i = 0; i < ids.length; ++i) {
+    if (ids.IsValid(i)) {
+      found_rows.UnsafeAppend(static_cast<uint32_t>(i));
+      found_ids.UnsafeAppend(id_values[i] + id_offset);
+    } else {
+      missing_rows.UnsafeAppend(static_cast<uint32_t>(i));
+    }
+  }
+  LookupResult result;
+  RETURN_NOT_OK(found_rows.Finish(&result.found_rows));
+  RETURN_NOT_OK(found_ids.Finish(&result.found_ids));
+  RETURN_NOT_OK(missing_rows.Finish(&result.missing_rows));
+  return result;
+}
+
+}  // namespace
+
 Status GroupByNode::Init() {
-  output_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
+  QueryContext* query_context = plan_->query_context();
+  output_task_group_id_ = query_context->RegisterTaskGroup(
       [this](size_t, int64_t task_id) { return OutputNthBatch(task_id); },
       [](size_t) { return Status::OK(); });
+  partition_uniques_task_group_id_ = query_context->RegisterTaskGroup(
+      [this](size_t, int64_t task_id) { return PartitionUniques(task_id); },
+      [this](size_t) {
+        return plan_->query_context()->StartTaskGroup(merge_partition_task_group_id_,
+                                                      kNumPartitions);
+      });
+  merge_partition_task_group_id_ = query_context->RegisterTaskGroup(
+      [this](size_t, int64_t task_id) { return MergePartition(task_id); },
+      [this](size_t) { return OnPartitionsMerged(); });
+  merge_aggregate_task_group_id_ = query_context->RegisterTaskGroup(
+      [this](size_t, int64_t task_id) { return MergeAggregate(task_id); },
+      [this](size_t) { return OnAggregatesMerged(); });
+
+  // Keys can be partitioned if they can be hashed the way HashPartitionedSpill does
+  const auto& input_schema = inputs_[0]->output_schema();
+  can_partition_keys_ = segment_key_field_ids_.empty() && !key_field_ids_.empty();
+  // Groupers and kernel states don't report their memory use, so the size of the
+  // thread-local states is estimated from the number of groups
+  bytes_per_group_ = 16 + 16 * static_cast<int64_t>(agg_kernels_.size());
+  for (int key_field_id : key_field_ids_) {
+    const std::shared_ptr<DataType>& type = input_schema->field(key_field_id)->type();
+    key_types_.emplace_back(type.get());
+    if (type->id() == Type::DICTIONARY ||
+        !compute::ColumnMetadataFromDataType(type).ok()) {
+      can_partition_keys_ = false;
+    }
+    bytes_per_group_ += is_fixed_width(type->id()) ? std::max(1, type->byte_width()) : 32;
+  }
+
+  // Spilled rows are aggregated after all others, so ordered aggregates can't spill
+  spill_memory_limit_ = query_context->options().spill_memory_limit;
+  for (const HashAggregateKernel* kernel : agg_kernels_) {
+    if (kernel->ordered) {
+      spill_memory_limit_ = 0;
+    }
+  }
+  if (!can_partition_keys_) {
+    spill_memory_limit_ = 0;
+  }
   return Status::OK();
 }
 
@@ -217,16 +331,27 @@ Status GroupByNode::Consume(ExecSpan batch) {
   auto state = &local_states_[thread_index];
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
-  // Create a batch with key columns
-  std::vector<ExecValue> keys(key_field_ids_.size());
-  for (size_t i = 0; i < key_field_ids_.size(); ++i) {
-    keys[i] = batch[key_field_ids_[i]];
+  if (spilling_.load()) {
+    return ConsumeSpilling(thread_index, state, batch);
   }
-  ExecSpan key_batch(std::move(keys), batch.length);
+
+  // Create a batch with key columns
+  ExecSpan key_batch = SelectColumns(batch, key_field_ids_);
 
   // Create a batch with group ids
   ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
 
+  RETURN_NOT_OK(ConsumeAggregates(batch, *id_batch.array(),
+                                  state->grouper->num_groups(), &state->agg_states));
+  if (spill_memory_limit_ > 0) {
+    return AccountForNewGroups(state);
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::ConsumeAggregates(
+    const ExecSpan& batch, const ArrayData& group_ids, uint32_t num_groups,
+    std::vector<std::unique_ptr<KernelState>>* agg_states) {
   // Execute aggregate kernels
   for (size_t i = 0; i < agg_kernels_.size(); ++i) {
     arrow::util::tracing::Span span;
@@ -237,21 +362,69 @@ Status GroupByNode::Consume(ExecSpan batch) {
                         {"function.kind", std::string(kind_name()) + "::Consume"}});
     auto ctx = plan_->query_context()->exec_context();
     KernelContext kernel_ctx{ctx};
-    kernel_ctx.SetState(state->agg_states[i].get());
+    kernel_ctx.SetState((*agg_states)[i].get());
 
     std::vector<ExecValue> column_values;
     for (const int field : agg_src_fieldsets_[i]) {
       column_values.push_back(batch[field]);
     }
-    column_values.emplace_back(*id_batch.array());
+    column_values.emplace_back(group_ids);
     ExecSpan agg_batch(std::move(column_values), batch.length);
-    RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, state->grouper->num_groups()));
+    RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, num_groups));
     RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
   }
 
   return Status::OK();
 }
 
+Status GroupByNode::ConsumeSpilling(size_t thread_index, ThreadLocalState* state,
+                                    const ExecSpan& batch) {
+  // Rows of groups this thread already holds are aggregated in memory, the others
+  // are spilled
+  ExecContext* ctx = plan_->query_context()->exec_context();
+  ARROW_ASSIGN_OR_RAISE(Datum ids,
+                        state->grouper->Lookup(SelectColumns(batch, key_field_ids_)));
+  ARROW_ASSIGN_OR_RAISE(LookupResult lookup,
+                        SplitByLookup(*ids.array(), 0, ctx->memory_pool()));
+  ExecBatch full_batch = batch.ToExecBatch();
+  if (lookup.found_rows->length() > 0) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch found, TakeRows(full_batch, lookup.found_rows, ctx));
+    RETURN_NOT_OK(ConsumeAggregates(ExecSpan(found), *lookup.found_ids->data(),
+                                    state->grouper->num_groups(), &state->agg_states));
+  }
+  if (lookup.missing_rows->length() > 0) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch missing,
+                          TakeRows(full_batch, lookup.missing_rows, ctx));
+    RETURN_NOT_OK(spill_.Append(thread_index, missing));
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::AccountForNewGroups(ThreadLocalState* state) {
+  uint32_t num_groups = state->grouper->num_groups();
+  int64_t added_bytes =
+      static_cast<int64_t>(num_groups - state->num_groups_accounted) * bytes_per_group_;
+  state->num_groups_accounted = num_groups;
+  if (in_memory_bytes_.fetch_add(added_bytes) + added_bytes > spill_memory_limit_) {
+    return StartSpilling();
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::StartSpilling() {
+  std::lock_guard<std::mutex> guard(spill_mutex_);
+  if (spilling_.load()) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                        arrow::internal::TemporaryDir::Make("arrow-acero-groupby-"));
+  RETURN_NOT_OK(spill_.Init(plan_->query_context(), local_states_.size(),
+                            spill_dir_->path().ToString(), "groupby",
+                            inputs_[0]->output_schema(), key_field_ids_));
+  spilling_.store(true);
+  return Status::OK();
+}
+
 Status GroupByNode::Merge() {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Merge",
@@ -282,11 +455,9 @@ Status GroupByNode::Merge() {
       DCHECK(state0->agg_states[span_i]);
       batch_ctx.SetState(state0->agg_states[span_i].get());
 
-      // XXX this resizes each KernelState (state0->agg_states[span_i]) multiple times.
-      // An alternative would be a two-pass algorithm:
-      // 1. Compute all transpositions (one per local state) and the final number of
-      // groups.
-      // 2. Process all agg kernels, resizing each KernelState only once.
+      // This resizes each KernelState (state0->agg_states[span_i]) multiple times.
+      // Merges of many groups go through StartPartitionedMerge instead, which
+      // computes all transpositions first and resizes each KernelState only once.
       RETURN_NOT_OK(
           agg_kernels_[span_i]->resize(&batch_ctx, state0->grouper->num_groups()));
       RETURN_NOT_OK(agg_kernels_[span_i]->merge(
@@ -297,25 +468,274 @@ Status GroupByNode::Merge() {
   return Status::OK();
 }
 
-Result<ExecBatch> GroupByNode::Finalize() {
+bool GroupByNode::UsePartitionedMerge() const {
+  if (spilling_.load()) {
+    return true;
+  }
+  if (!can_partition_keys_) {
+    return false;
+  }
+  int num_states = 0;
+  int64_t num_groups = 0;
+  for (const ThreadLocalState& state : local_states_) {
+    if (state.grouper) {
+      num_states += 1;
+      num_groups += state.grouper->num_groups();
+    }
+  }
+  return num_states > 1 && num_groups >= kMinGroupsForPartitionedMerge;
+}
+
+Status GroupByNode::StartPartitionedMerge() {
+  merge_sources_.clear();
+  for (size_t i = 0; i < local_states_.size(); ++i) {
+    if (local_states_[i].grouper) {
+      merge_sources_.emplace_back();
+      merge_sources_.back().state_index = i;
+    }
+  }
+  merged_groupers_.resize(kNumPartitions);
+  return plan_->query_context()->StartTaskGroup(partition_uniques_task_group_id_,
+                                                merge_sources_.size());
+}
+
+Status GroupByNode::PartitionUniques(int64_t source_index) {
+  MergeSource& source = merge_sources_[source_index];
+  ThreadLocalState& state = local_states_[source.state_index];
+  ARROW_ASSIGN_OR_RAISE(source.uniques, state.grouper->GetUniques());
+  state.grouper.reset();
+  int64_t num_groups = source.uniques.length;
+
+  std::vector<uint32_t> hashes(num_groups);
+  if (num_groups > 0) {
+    QueryContext* ctx = plan_->query_context();
+    arrow::util::TempVectorStack stack;
+    RETURN_NOT_OK(stack.Init(ctx->memory_pool(), Hashing32::kHashBatchTempStackUsage));
+    std::vector<compute::KeyColumnArray> temp_column_arrays;
+    RETURN_NOT_OK(Hashing32::HashBatch(source.uniques, hashes.data(), temp_column_arrays,
+                                       ctx->cpu_info()->hardware_flags(), &stack, 0,
+                                       num_groups));
+  }
+
+  // Counting sort of the groups by partition
+  source.partition_of_group.resize(num_groups);
+  source.partition_ranges.assign(kNumPartitions + 1, 0);
+  for (int64_t i = 0; i < num_groups; ++i) {
+    int partition = HashPartitionedSpill::PartitionId(hashes[i]);
+    source.partition_of_group[i] = static_cast<uint8_t>(partition);
+    source.partition_ranges[partition + 1] += 1;
+  }
+  for (int i = 0; i < kNumPartitions; ++i) {
+    source.partition_ranges[i + 1] += source.partition_ranges[i];
+  }
+  std::vector<int64_t> positions(source.partition_ranges.begin(),
+                                 source.partition_ranges.end() - 1);
+  source.groups_by_partition.resize(num_groups);
+  for (int64_t i = 0; i < num_groups; ++i) {
+    source.groups_by_partition[positions[source.partition_of_group[i]]++] =
+        static_cast<uint32_t>(i);
+  }
+  source.transposition.resize(num_groups);
+  return Status::OK();
+}
+
+Status GroupByNode::MergePartition(int64_t partition) {
+  ExecContext* ctx = plan_->query_context()->exec_context();
+  ARROW_ASSIGN_OR_RAISE(merged_groupers_[partition], Grouper::Make(key_types_, ctx));
+  Grouper* grouper = merged_groupers_[partition].get();
+  for (MergeSource& source : merge_sources_) {
+    int64_t begin = source.partition_ranges[partition];
+    int64_t length = source.partition_ranges[partition + 1] - begin;
+    if (length == 0) {
+      continue;
+    }
+    const uint32_t* groups = source.groups_by_partition.data() + begin;
+    ARROW_ASSIGN_OR_RAISE(ExecBatch keys,
+                          TakeRows(source.uniques, WrapUInt32(groups, length), ctx));
+    ARROW_ASSIGN_OR_RAISE(Datum ids, grouper->Consume(ExecSpan(keys)));
+    const uint32_t* id_values = ids.array()->GetValues<uint32_t>(1);
+    for (int64_t i = 0; i < length; ++i) {
+      source.transposition[groups[i]] = id_values[i];
+    }
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::OnPartitionsMerged() {
+  // The merged groups are numbered partition by partition
+  merged_partition_offsets_.assign(kNumPartitions + 1, 0);
+  for (int i = 0; i < kNumPartitions; ++i) {
+    merged_partition_offsets_[i + 1] =
+        merged_partition_offsets_[i] + merged_groupers_[i]->num_groups();
+  }
+  merged_num_groups_ = merged_partition_offsets_[kNumPartitions];
+  for (MergeSource& source : merge_sources_) {
+    source.uniques = ExecBatch();
+    for (size_t i = 0; i < source.transposition.size(); ++i) {
+      source.transposition[i] += merged_partition_offsets_[source.partition_of_group[i]];
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(merged_states_,
+                        InitKernels(agg_kernels_, plan_->query_context()->exec_context(),
+                                    aggs_, agg_src_types_));
+  return plan_->query_context()->StartTaskGroup(merge_aggregate_task_group_id_,
+                                                agg_kernels_.size());
+}
+
+Status GroupByNode::MergeAggregate(int64_t kernel_index) {
   arrow::util::tracing::Span span;
-  START_COMPUTE_SPAN(span, "Finalize",
-                     {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
+  START_COMPUTE_SPAN(span, aggs_[kernel_index].function,
+                     {{"function.name", aggs_[kernel_index].function},
+                      {"function.options", aggs_[kernel_index].options
+                                               ? aggs_[kernel_index].options->ToString()
+                                               : "<NULLPTR>"},
+                      {"function.kind", std::string(kind_name()) + "::Merge"}});
+  KernelContext kernel_ctx{plan_->query_context()->exec_context()};
+  kernel_ctx.SetState(merged_states_[kernel_index].get());
+  RETURN_NOT_OK(agg_kernels_[kernel_index]->resize(&kernel_ctx, merged_num_groups_));
+  for (const MergeSource& source : merge_sources_) {
+    auto& agg_state = local_states_[source.state_index].agg_states[kernel_index];
+    auto transposition =
+        WrapUInt32(source.transposition.data(), source.transposition.size());
+    RETURN_NOT_OK(agg_kernels_[kernel_index]->merge(&kernel_ctx, std::move(*agg_state),
+                                                    *transposition));
+    agg_state.reset();
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::OnAggregatesMerged() {
+  merge_sources_.clear();
+  if (spilling_.load()) {
+    RETURN_NOT_OK(spill_.FinishWriting());
+    return ProcessSpilledPartition(0);
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch keys, MergedKeys());
+  ARROW_ASSIGN_OR_RAISE(out_data_, FinalizeStates(std::move(keys), &merged_states_));
+  int64_t num_output_batches = bit_util::CeilDiv(out_data_.length, output_batch_size());
+  total_output_batches_ += static_cast<int>(num_output_batches);
+  RETURN_NOT_OK(output_->InputFinished(this, total_output_batches_));
+  return plan_->query_context()->StartTaskGroup(output_task_group_id_,
+                                                num_output_batches);
+}
+
+Result<ExecBatch> GroupByNode::MergedKeys() {
+  std::vector<ExecBatch> partition_keys(kNumPartitions);
+  for (int i = 0; i < kNumPartitions; ++i) {
+    ARROW_ASSIGN_OR_RAISE(partition_keys[i], merged_groupers_[i]->GetUniques());
+    merged_groupers_[i].reset();
+  }
+  ExecBatch keys({}, merged_num_groups_);
+  for (size_t column = 0; column < key_types_.size(); ++column) {
+    ArrayVector chunks(kNumPartitions);
+    for (int i = 0; i < kNumPartitions; ++i) {
+      chunks[i] = partition_keys[i][column].make_array();
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto merged, Concatenate(chunks, plan_->query_context()->memory_pool()));
+    keys.values.emplace_back(std::move(merged));
+  }
+  return keys;
+}
 
+// Aggregates the spilled rows of one partition after the in-memory states were
+// merged. Rows of groups that were merged are added to the merged state, all other
+// groups of the partition are new and are output once the partition is done.
+Status GroupByNode::ProcessSpilledPartition(int partition) {
+  QueryContext* query_context = plan_->query_context();
+  if (partition == kNumPartitions) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch keys, MergedKeys());
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_data,
+                          FinalizeStates(std::move(keys), &merged_states_));
+    RETURN_NOT_OK(OutputBatches(out_data));
+    return output_->InputFinished(this, total_output_batches_);
+  }
+
+  ExecContext* ctx = query_context->exec_context();
+  SpillFile* file = spill_.partition(partition);
+  Grouper* merged_grouper = merged_groupers_[partition].get();
+  ThreadLocalState new_groups;
+  RETURN_NOT_OK(InitLocalStateIfNeeded(&new_groups));
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(std::optional<ExecBatch> batch, file->ReadNext());
+    if (!batch) {
+      break;
+    }
+    ExecSpan span(*batch);
+    ARROW_ASSIGN_OR_RAISE(Datum ids,
+                          merged_grouper->Lookup(SelectColumns(span, key_field_ids_)));
+    ARROW_ASSIGN_OR_RAISE(
+        LookupResult lookup,
+        SplitByLookup(*ids.array(), merged_partition_offsets_[partition],
+                      ctx->memory_pool()));
+    if (lookup.found_rows->length() > 0) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch found, TakeRows(*batch, lookup.found_rows, ctx));
+      RETURN_NOT_OK(ConsumeAggregates(ExecSpan(found), *lookup.found_ids->data(),
+                                      merged_num_groups_, &merged_states_));
+    }
+    if (lookup.missing_rows->length() > 0) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch missing,
+                            TakeRows(*batch, lookup.missing_rows, ctx));
+      ExecSpan missing_span(missing);
+      ARROW_ASSIGN_OR_RAISE(
+          Datum new_ids,
+          new_groups.grouper->Consume(SelectColumns(missing_span, key_field_ids_)));
+      RETURN_NOT_OK(ConsumeAggregates(missing_span, *new_ids.array(),
+                                      new_groups.grouper->num_groups(),
+                                      &new_groups.agg_states));
+    }
+  }
+  spill_.ReleasePartition(partition);
+
+  if (new_groups.grouper->num_groups() > 0) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch keys, new_groups.grouper->GetUniques());
+    new_groups.grouper.reset();
+    ARROW_ASSIGN_OR_RAISE(ExecBatch out_data,
+                          FinalizeStates(std::move(keys), &new_groups.agg_states));
+    RETURN_NOT_OK(OutputBatches(out_data));
+  }
+  query_context->ScheduleTask(
+      [this, partition]() { return ProcessSpilledPartition(partition + 1); },
+      "GroupByNode::ProcessSpilledPartition");
+  return Status::OK();
+}
+
+Status GroupByNode::OutputBatches(const ExecBatch& batch) {
+  int64_t batch_size = output_batch_size();
+  for (int64_t offset = 0; offset < batch.length; offset += batch_size) {
+    RETURN_NOT_OK(output_->InputReceived(this, batch.Slice(offset, batch_size)));
+    total_output_batches_ += 1;
+  }
+  return Status::OK();
+}
+
+Result<ExecBatch> GroupByNode::Finalize() {
   ThreadLocalState* state = &local_states_[0];
   // If we never got any batches, then state won't have been initialized
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state->grouper->GetUniques());
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_data,
+                        FinalizeStates(std::move(out_keys), &state->agg_states));
+  state->grouper.reset();
+  return out_data;
+}
+
+Result<ExecBatch> GroupByNode::FinalizeStates(
+    ExecBatch keys, std::vector<std::unique_ptr<KernelState>>* agg_states) {
+  arrow::util::tracing::Span span;
+  START_COMPUTE_SPAN(span, "Finalize",
+                     {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
+
   // Allocate a batch for output
-  ExecBatch out_data{{}, state->grouper->num_groups()};
+  ExecBatch out_data{{}, keys.length};
   out_data.values.resize(agg_kernels_.size() + key_field_ids_.size() +
                          segment_key_field_ids_.size());
 
   // Segment keys come first
   PlaceFields(out_data, 0, segmenter_values_);
   // Followed by keys
-  ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state->grouper->GetUniques());
-  std::move(out_keys.values.begin(), out_keys.values.end(),
+  std::move(keys.values.begin(), keys.values.end(),
             out_data.values.begin() + segment_key_field_ids_.size());
   // And finally, the aggregates themselves
   std::size_t base = segment_key_field_ids_.size() + key_field_ids_.size();
@@ -327,11 +747,10 @@ Result<ExecBatch> GroupByNode::Finalize() {
                          aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
                         {"function.kind", std::string(kind_name()) + "::Finalize"}});
     KernelContext batch_ctx{plan_->query_context()->exec_context()};
-    batch_ctx.SetState(state->agg_states[i].get());
+    batch_ctx.SetState((*agg_states)[i].get());
     RETURN_NOT_OK(agg_kernels_[i]->finalize(&batch_ctx, &out_data.values[i + base]));
-    state->agg_states[i].reset();
+    (*agg_states)[i].reset();
   }
-  state->grouper.reset();
 
   return out_data;
 }
@@ -342,6 +761,10 @@ Status GroupByNode::OutputNthBatch(int64_t n) {
 }
 
 Status GroupByNode::OutputResult(bool is_last) {
+  if (is_last && UsePartitionedMerge()) {
+    return StartPartitionedMerge();
+  }
+
   // To simplify merging, ensure that the first grouper is nonempty
   for (size_t i = 0; i < local_states_.size(); i++) {
     if (local_states_[i].grouper) {
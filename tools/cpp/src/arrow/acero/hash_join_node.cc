@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_set>
 #include <utility>
 
@@ -26,11 +27,17 @@
 #include "arrow/acero/hash_join_dict.h"
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/spill_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
@@ -41,6 +48,8 @@ using internal::checked_cast;
 
 using compute::field_ref;
 using compute::FilterOptions;
+using compute::ScalarAggregateOptions;
+using compute::SetLookupOptions;
 using compute::Hashing32;
 using compute::KeyColumnArray;
 
@@ -62,6 +71,28 @@ Status ValidateHashJoinNodeOptions(const HashJoinNodeOptions& join_options) {
   return Status::OK();
 }
 
+// Joins that never output probe rows without a match, so that filters derived from the
+// build side keys can be pushed into the probe input
+bool CanPushRuntimeFilters(JoinType join_type) {
+  switch (join_type) {
+    case JoinType::INNER:
+    case JoinType::LEFT_SEMI:
+    case JoinType::RIGHT_OUTER:
+    case JoinType::RIGHT_SEMI:
+    case JoinType::RIGHT_ANTI:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Key types whose range and values make a useful runtime filter.  Floating point keys
+// are left out because NaN does not compare within any range.
+bool CanFilterOnKeyValues(const DataType& type) {
+  return is_integer(type.id()) || is_temporal(type.id()) ||
+         is_base_binary_like(type.id());
+}
+
 }  // namespace
 
 // Check if a type is supported in a join (as either a key or non-key column)
@@ -527,19 +558,40 @@ struct BloomFilterPushdownContext {
   // Sends the Bloom filter to the pushdown target.
   Status PushBloomFilter(size_t thread_index);
 
-  // Receives a Bloom filter and its associated column map.
+  // Tells the pushdown target that no Bloom filter will be sent to it, because the
+  // build side is spilled rather than kept in memory.  Must be called instead of
+  // BuildBloomFilter and PushBloomFilter.
+  Status SkipBloomFilter(size_t thread_index);
+
+  // The Bloom filter, if it is pushed to the owner itself, and the columns of the
+  // owner's probe input it applies to.  Must be called before PushBloomFilter.
+  std::shared_ptr<BlockedBloomFilter> GetProbeInputBloomFilter(
+      const HashJoinNode* owner, std::vector<int>* column_map) const {
+    if (disable_bloom_filter_ || push_.pushdown_target_ != owner) {
+      return nullptr;
+    }
+    *column_map = push_.column_map_;
+    return push_.bloom_filter_;
+  }
+
+  // Receives a Bloom filter and its associated column map.  A null filter is sent by
+  // a join that skipped building its Bloom filter, and lets all rows pass.
   Status ReceiveBloomFilter(size_t thread_index,
-                            std::unique_ptr<BlockedBloomFilter> filter,
+                            std::shared_ptr<BlockedBloomFilter> filter,
                             std::vector<int> column_map) {
     bool proceed;
     {
       std::lock_guard<std::mutex> guard(eval_.receive_mutex_);
-      eval_.received_filters_.emplace_back(std::move(filter));
-      eval_.received_maps_.emplace_back(std::move(column_map));
-      proceed = eval_.num_expected_bloom_filters_ == eval_.received_filters_.size();
+      if (filter != nullptr) {
+        eval_.received_filters_.emplace_back(std::move(filter));
+        eval_.received_maps_.emplace_back(std::move(column_map));
+      }
+      ++eval_.num_received_bloom_filters_;
+      proceed = eval_.num_expected_bloom_filters_ == eval_.num_received_bloom_filters_;
 
       ARROW_DCHECK_EQ(eval_.received_filters_.size(), eval_.received_maps_.size());
-      ARROW_DCHECK_LE(eval_.received_filters_.size(), eval_.num_expected_bloom_filters_);
+      ARROW_DCHECK_LE(eval_.num_received_bloom_filters_,
+                      eval_.num_expected_bloom_filters_);
     }
     if (proceed) {
       return eval_.all_received_callback_(thread_index);
@@ -554,7 +606,7 @@ struct BloomFilterPushdownContext {
     eval_.batches_ = std::move(batches);
     eval_.on_finished_ = std::move(on_finished);
 
-    if (eval_.num_expected_bloom_filters_ == 0)
+    if (eval_.received_filters_.empty())
       return eval_.on_finished_(thread_index, std::move(eval_.batches_));
 
     return start_task_group_callback_(eval_.task_id_,
@@ -564,7 +616,7 @@ struct BloomFilterPushdownContext {
   // Applies all Bloom filters on the input batch.
   Status FilterSingleBatch(size_t thread_index, ExecBatch* batch_ptr) {
     ExecBatch& batch = *batch_ptr;
-    if (eval_.num_expected_bloom_filters_ == 0 || batch.length == 0) return Status::OK();
+    if (eval_.received_filters_.empty() || batch.length == 0) return Status::OK();
 
     int64_t bit_vector_bytes = bit_util::BytesForBits(batch.length);
     std::vector<uint8_t> selected(bit_vector_bytes);
@@ -575,7 +627,7 @@ struct BloomFilterPushdownContext {
 
     // Start with full selection for the current batch
     memset(selected.data(), 0xff, bit_vector_bytes);
-    for (size_t ifilter = 0; ifilter < eval_.num_expected_bloom_filters_; ifilter++) {
+    for (size_t ifilter = 0; ifilter < eval_.received_filters_.size(); ifilter++) {
       std::vector<Datum> keys(eval_.received_maps_[ifilter].size());
       for (size_t i = 0; i < keys.size(); i++) {
         int input_idx = eval_.received_maps_[ifilter][i];
@@ -650,7 +702,7 @@ struct BloomFilterPushdownContext {
   } build_;
 
   struct {
-    std::unique_ptr<BlockedBloomFilter> bloom_filter_;
+    std::shared_ptr<BlockedBloomFilter> bloom_filter_;
     HashJoinNode* pushdown_target_;
     std::vector<int> column_map_;
   } push_;
@@ -658,8 +710,9 @@ struct BloomFilterPushdownContext {
   struct {
     int task_id_;
     size_t num_expected_bloom_filters_ = 0;
+    size_t num_received_bloom_filters_ = 0;
     std::mutex receive_mutex_;
-    std::vector<std::unique_ptr<BlockedBloomFilter>> received_filters_;
+    std::vector<std::shared_ptr<BlockedBloomFilter>> received_filters_;
     std::vector<std::vector<int>> received_maps_;
     AccumulationQueue batches_;
     FiltersReceivedCallback all_received_callback_;
@@ -709,7 +762,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl, int64_t spill_memory_limit)
       : ExecNode(plan, std::move(inputs), {"left", "right"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -718,8 +771,10 @@ class HashJoinNode : public ExecNode, public TracedNode {
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
         impl_(std::move(impl)),
+        spill_memory_limit_(spill_memory_limit),
         disable_bloom_filter_(join_options.disable_bloom_filter) {
     complete_.store(false);
+    spilling_.store(false);
   }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -776,9 +831,14 @@ class HashJoinNode : public ExecNode, public TracedNode {
       ARROW_ASSIGN_OR_RAISE(impl, HashJoinImpl::MakeBasic());
     }
 
+    // Spilled partitions are joined with SwissJoin, so joins that need the basic
+    // implementation always keep their build side in memory
+    int64_t spill_memory_limit =
+        use_swiss_join ? plan->query_context()->options().spill_memory_limit : 0;
+
     return plan->EmplaceNode<HashJoinNode>(
         plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        std::move(filter), std::move(impl), spill_memory_limit);
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
@@ -787,12 +847,64 @@ class HashJoinNode : public ExecNode, public TracedNode {
     if (batch.length == 0) {
       return Status::OK();
     }
-    std::lock_guard<std::mutex> guard(build_side_mutex_);
-    build_accumulator_.InsertBatch(std::move(batch));
+    AccumulationQueue batches_to_spill;
+    bool started_spilling = false;
+    {
+      std::lock_guard<std::mutex> guard(build_side_mutex_);
+      if (!spilling_.load()) {
+        build_side_bytes_ += batch.TotalBufferSize();
+        build_accumulator_.InsertBatch(std::move(batch));
+        if (spill_memory_limit_ <= 0 || build_side_bytes_ <= spill_memory_limit_) {
+          return Status::OK();
+        }
+        RETURN_NOT_OK(StartSpilling());
+        started_spilling = true;
+        batches_to_spill = std::move(build_accumulator_);
+      } else {
+        batches_to_spill.InsertBatch(std::move(batch));
+      }
+    }
+    if (started_spilling) {
+      // A Bloom filter needs the entire build side, which is no longer held in
+      // memory.  The pushdown target is told right away so that it stops holding
+      // back its probe batches.
+      RETURN_NOT_OK(pushdown_context_.SkipBloomFilter(thread_index));
+    }
+    for (size_t i = 0; i < batches_to_spill.batch_count(); ++i) {
+      RETURN_NOT_OK(build_spill_.Append(thread_index, batches_to_spill[i]));
+    }
+    return Status::OK();
+  }
+
+  // Called once the build side exceeds the memory budget.  From then on both inputs
+  // are partitioned on their keys and written to disk, and the partitions are joined
+  // one at a time after the probe side has finished.
+  Status StartSpilling() {
+    QueryContext* ctx = plan_->query_context();
+    ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                          arrow::internal::TemporaryDir::Make("arrow-acero-join-"));
+    for (int side = 0; side <= 1; ++side) {
+      SchemaProjectionMap key_to_input = schema_mgr_->proj_maps[side].map(
+          HashJoinProjection::KEY, HashJoinProjection::INPUT);
+      std::vector<int> key_ids(key_to_input.num_cols);
+      for (int i = 0; i < key_to_input.num_cols; ++i) {
+        key_ids[i] = key_to_input.get(i);
+      }
+      HashPartitionedSpill& spill = side == 0 ? probe_spill_ : build_spill_;
+      RETURN_NOT_OK(spill.Init(ctx, num_threads_, spill_dir_->path().ToString(),
+                               side == 0 ? "probe" : "build",
+                               inputs_[side]->output_schema(), std::move(key_ids)));
+    }
+    spilling_.store(true);
     return Status::OK();
   }
 
   Status OnBuildSideFinished(size_t thread_index) {
+    if (spilling_.load()) {
+      RETURN_NOT_OK(build_spill_.FinishWriting());
+      // There is no hash table, but probe batches can now be partitioned as well
+      return OnHashTableFinished(thread_index);
+    }
     return pushdown_context_.BuildBloomFilter(
         thread_index, std::move(build_accumulator_),
         [this](size_t thread_index, AccumulationQueue batches) {
@@ -801,12 +913,110 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
   Status OnBloomFilterFinished(size_t thread_index, AccumulationQueue batches) {
+    if (CanPushRuntimeFilters(join_type_)) {
+      RETURN_NOT_OK(PushRuntimeFilters(batches));
+    }
     RETURN_NOT_OK(pushdown_context_.PushBloomFilter(thread_index));
     return impl_->BuildHashTable(
         thread_index, std::move(batches),
         [this](size_t thread_index) { return OnHashTableFinished(thread_index); });
   }
 
+  // Pushes filters that probe rows must pass to find a match into the probe input: the
+  // range of every key on the build side, its values if there are only a few, and the
+  // Bloom filter if this join evaluates it itself.  A source feeding the probe side can
+  // use them to skip files and row groups and drops the rows that fail them.
+  Status PushRuntimeFilters(AccumulationQueue& build_batches) {
+    SchemaProjectionMap probe_key_to_input =
+        schema_mgr_->proj_maps[0].map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    SchemaProjectionMap build_key_to_input =
+        schema_mgr_->proj_maps[1].map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    const Schema& probe_schema = *inputs_[0]->output_schema();
+    const Schema& build_schema = *inputs_[1]->output_schema();
+    for (int i = 0; i < probe_key_to_input.num_cols; ++i) {
+      int probe_id = probe_key_to_input.get(i);
+      int build_id = build_key_to_input.get(i);
+      const DataType& type = *probe_schema.field(probe_id)->type();
+      if (!CanFilterOnKeyValues(type) ||
+          !type.Equals(*build_schema.field(build_id)->type())) {
+        continue;
+      }
+      RuntimeFilter filter;
+      ARROW_ASSIGN_OR_RAISE(filter.expression,
+                            MakeKeyFilter(build_batches, build_id,
+                                          FieldRef(FieldPath({probe_id})),
+                                          key_cmp_[i] == JoinKeyCmp::IS));
+      RETURN_NOT_OK(inputs_[0]->PushRuntimeFilter(filter));
+    }
+
+    std::vector<int> bloom_filter_columns;
+    RuntimeFilter filter;
+    filter.bloom_filter =
+        pushdown_context_.GetProbeInputBloomFilter(this, &bloom_filter_columns);
+    if (filter.bloom_filter) {
+      for (int column : bloom_filter_columns) {
+        filter.bloom_filter_keys.emplace_back(FieldPath({column}));
+      }
+      RETURN_NOT_OK(inputs_[0]->PushRuntimeFilter(filter));
+    }
+    return Status::OK();
+  }
+
+  // The filter a probe key must pass to equal one of the build side keys.  With an
+  // empty build side nothing can match.  Null keys only match if `null_matches` is set
+  // and the build side has a null key.
+  Result<Expression> MakeKeyFilter(AccumulationQueue& build_batches, int build_id,
+                                   FieldRef probe_key, bool null_matches) {
+    QueryContext* ctx = plan_->query_context();
+    const auto& type = inputs_[1]->output_schema()->field(build_id)->type();
+    ArrayVector chunks;
+    for (size_t i = 0; i < build_batches.batch_count(); ++i) {
+      const Datum& value = build_batches[i][build_id];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> array,
+                              MakeArrayFromScalar(*value.scalar(),
+                                                  build_batches[i].length,
+                                                  ctx->memory_pool()));
+        chunks.push_back(std::move(array));
+      } else {
+        chunks.push_back(value.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto keys, ChunkedArray::Make(std::move(chunks), type));
+    Expression match_null = compute::literal(false);
+    if (null_matches && keys->null_count() > 0) {
+      match_null = compute::is_null(field_ref(probe_key));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum min_max,
+                          compute::MinMax(keys, ScalarAggregateOptions::Defaults(),
+                                          ctx->exec_context()));
+    const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+    if (!min_max_scalar.value[0]->is_valid) {
+      return match_null;
+    }
+    Expression filter =
+        compute::and_(compute::greater_equal(field_ref(probe_key),
+                                             compute::literal(min_max_scalar.value[0])),
+                      compute::less_equal(field_ref(probe_key),
+                                          compute::literal(min_max_scalar.value[1])));
+    if (build_batches.row_count() <= kMaxRuntimeFilterInListBuildRows) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> values,
+                            compute::Unique(keys, ctx->exec_context()));
+      ARROW_ASSIGN_OR_RAISE(Datum non_null_values,
+                            compute::DropNull(values, ctx->exec_context()));
+      if (non_null_values.length() <= kMaxRuntimeFilterValues) {
+        filter = compute::and_(
+            std::move(filter),
+            compute::call("is_in", {field_ref(probe_key)},
+                          SetLookupOptions(std::move(non_null_values))));
+      }
+    }
+    if (match_null != compute::literal(false)) {
+      return compute::or_(std::move(filter), std::move(match_null));
+    }
+    return filter;
+  }
+
   Status OnHashTableFinished(size_t thread_index) {
     bool should_probe;
     {
@@ -832,13 +1042,27 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
-      if (!hash_table_ready_) {
+      if (!hash_table_ready_ && !spilling_.load()) {
         probe_accumulator_.InsertBatch(std::move(batch));
         return Status::OK();
       }
     }
-    RETURN_NOT_OK(impl_->ProbeSingleBatch(thread_index, std::move(batch)));
-    return Status::OK();
+    return ProbeSingleBatch(thread_index, std::move(batch));
+  }
+
+  Status ProbeSingleBatch(size_t thread_index, ExecBatch batch) {
+    if (spilling_.load()) {
+      return probe_spill_.Append(thread_index, batch);
+    }
+    return impl_->ProbeSingleBatch(thread_index, std::move(batch));
+  }
+
+  Status ProbingFinished(size_t thread_index) {
+    if (spilling_.load()) {
+      RETURN_NOT_OK(probe_spill_.FinishWriting());
+      return JoinNextSpilledPartition(thread_index);
+    }
+    return impl_->ProbingFinished(thread_index);
   }
 
   Status OnProbeSideFinished(size_t thread_index) {
@@ -848,7 +1072,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
       probing_finished = queued_batches_probed_ && !probe_side_finished_;
       probe_side_finished_ = true;
     }
-    if (probing_finished) return impl_->ProbingFinished(thread_index);
+    if (probing_finished) return ProbingFinished(thread_index);
     return Status::OK();
   }
 
@@ -895,7 +1119,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
       probing_finished = !queued_batches_probed_ && probe_side_finished_;
       queued_batches_probed_ = true;
     }
-    if (probing_finished) return impl_->ProbingFinished(thread_index);
+    if (probing_finished) return ProbingFinished(thread_index);
     return Status::OK();
   }
 
@@ -953,6 +1177,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
     // Each side of join might have an IO thread being called from. Once this is fixed
     // we will change it back to just the CPU's thread pool capacity.
     size_t num_threads = (GetCpuThreadPoolCapacity() + io::GetIOThreadPoolCapacity() + 1);
+    num_threads_ = num_threads;
 
     RETURN_NOT_OK(pushdown_context_.Init(
         this, num_threads,
@@ -983,8 +1208,8 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
     task_group_probe_ = ctx->RegisterTaskGroup(
         [this](size_t thread_index, int64_t task_id) -> Status {
-          return impl_->ProbeSingleBatch(thread_index,
-                                         std::move(queued_batches_to_probe_[task_id]));
+          return ProbeSingleBatch(thread_index,
+                                  std::move(queued_batches_to_probe_[task_id]));
         },
         [this](size_t thread_index) -> Status {
           return OnQueuedBatchesProbed(thread_index);
@@ -1012,6 +1237,11 @@ class HashJoinNode : public ExecNode, public TracedNode {
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
       impl_->Abort([]() {});
+      std::lock_guard<std::mutex> guard(spilled_join_.mutex);
+      if (spilled_join_.current) {
+        spilled_join_.current->impl->Abort([]() {});
+        spilled_join_.current->scheduler->Abort([]() {});
+      }
     }
     return Status::OK();
   }
@@ -1034,6 +1264,117 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  // Joins the next spilled partition that has any rows, or finishes the node once
+  // all of them have been joined.  Each partition gets its own SwissJoin.  The spill
+  // files and the SwissJoin of a partition are released before the next partition's
+  // build side is read back, so only one partition of the spilled build side is in
+  // memory at a time.
+  Status JoinNextSpilledPartition(size_t thread_index) {
+    QueryContext* ctx = plan_->query_context();
+    std::lock_guard<std::mutex> guard(spilled_join_.mutex);
+    if (spilled_join_.partition >= 0) {
+      build_spill_.ReleasePartition(spilled_join_.partition);
+      probe_spill_.ReleasePartition(spilled_join_.partition);
+    }
+    // The previous partition's finished callback started this one and may still be
+    // unwinding, so its SwissJoin is only destroyed once the last of its tasks returns
+    spilled_join_.current.reset();
+    if (complete_.load()) {
+      return Status::OK();
+    }
+    int partition = spilled_join_.partition + 1;
+    while (partition < HashPartitionedSpill::kNumPartitions &&
+           build_spill_.partition(partition)->num_rows() == 0 &&
+           probe_spill_.partition(partition)->num_rows() == 0) {
+      ++partition;
+    }
+    spilled_join_.partition = partition;
+    if (partition == HashPartitionedSpill::kNumPartitions) {
+      return FinishedCallback(spilled_join_.num_output_batches);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(AccumulationQueue build_batches,
+                          build_spill_.partition(partition)->ReadAll());
+    auto join = std::make_shared<SpilledPartitionJoin>();
+    ARROW_ASSIGN_OR_RAISE(join->impl, HashJoinImpl::MakeSwiss());
+    // The task groups of the plan's scheduler are fixed once the plan starts, so
+    // every partition is run by a scheduler of its own.
+    join->scheduler = TaskScheduler::Make();
+    spilled_join_.current = join;
+    HashJoinImpl* impl = join->impl.get();
+    TaskScheduler* scheduler = join->scheduler.get();
+    RETURN_NOT_OK(impl->Init(
+        ctx, join_type_, num_threads_, &(schema_mgr_->proj_maps[0]),
+        &(schema_mgr_->proj_maps[1]), key_cmp_, filter_,
+        [scheduler](std::function<Status(size_t, int64_t)> fn,
+                    std::function<Status(size_t)> on_finished) {
+          return scheduler->RegisterTaskGroup(std::move(fn), std::move(on_finished));
+        },
+        [ctx, scheduler](int task_group_id, int64_t num_tasks) {
+          return scheduler->StartTaskGroup(ctx->GetThreadIndex(), task_group_id,
+                                           num_tasks);
+        },
+        [this](int64_t, ExecBatch batch) {
+          return OutputBatchCallback(std::move(batch));
+        },
+        [this](int64_t num_batches) { return OnSpilledPartitionFinished(num_batches); }));
+
+    SpillFile* probe_file = probe_spill_.partition(partition);
+    int task_group_probe = scheduler->RegisterTaskGroup(
+        [this, impl, probe_file](size_t thread_index, int64_t) -> Status {
+          // Tasks take the next batch rather than a batch of their own so that the
+          // file is read sequentially
+          std::optional<ExecBatch> batch;
+          {
+            std::lock_guard<std::mutex> guard(spilled_join_.probe_file_mutex);
+            ARROW_ASSIGN_OR_RAISE(batch, probe_file->ReadNext());
+          }
+          if (!batch.has_value()) {
+            return Status::Invalid("Spilled probe batches of the hash join ended ",
+                                   "before all ", probe_file->num_batches(),
+                                   " were read");
+          }
+          return impl->ProbeSingleBatch(thread_index, std::move(*batch));
+        },
+        [impl](size_t thread_index) { return impl->ProbingFinished(thread_index); });
+    scheduler->RegisterEnd();
+    // Tasks are only scheduled from this call or from the partition's own tasks, which
+    // both hold a reference to it.  Each task holds one in turn.
+    std::weak_ptr<SpilledPartitionJoin> weak_join = join;
+    RETURN_NOT_OK(scheduler->StartScheduling(
+        thread_index,
+        [ctx, weak_join](std::function<Status(size_t)> fn) -> Status {
+          std::shared_ptr<SpilledPartitionJoin> join = weak_join.lock();
+          DCHECK(join);
+          ctx->ScheduleTask(
+              [join = std::move(join), fn = std::move(fn)](size_t thread_index) {
+                return fn(thread_index);
+              },
+              "HashJoinNode::JoinSpilledPartition");
+          return Status::OK();
+        },
+        /*num_concurrent_tasks=*/2 * ctx->executor()->GetCapacity(),
+        /*use_sync_execution=*/false));
+
+    int64_t num_probe_batches = probe_file->num_batches();
+    return impl->BuildHashTable(
+        thread_index, std::move(build_batches),
+        [scheduler, task_group_probe, num_probe_batches](size_t thread_index) {
+          return scheduler->StartTaskGroup(thread_index, task_group_probe,
+                                           num_probe_batches);
+        });
+  }
+
+  Status OnSpilledPartitionFinished(int64_t num_batches) {
+    spilled_join_.num_output_batches += num_batches;
+    // This runs inside a task of the partition's own scheduler, so the next
+    // partition is started from a fresh task.
+    plan_->query_context()->ScheduleTask(
+        [this](size_t thread_index) { return JoinNextSpilledPartition(thread_index); },
+        "HashJoinNode::JoinNextSpilledPartition");
+    return Status::OK();
+  }
+
  private:
   AtomicCounter batch_count_[2];
   std::atomic<bool> complete_;
@@ -1050,12 +1391,42 @@ class HashJoinNode : public ExecNode, public TracedNode {
   std::mutex probe_side_mutex_;
 
   int task_group_probe_;
+  size_t num_threads_ = 0;
   bool bloom_filters_ready_ = false;
   bool hash_table_ready_ = false;
   bool queued_batches_filtered_ = false;
   bool queued_batches_probed_ = false;
   bool probe_side_finished_ = false;
 
+  // Spilling, see QueryOptions::spill_memory_limit
+  int64_t spill_memory_limit_;
+  int64_t build_side_bytes_ = 0;
+  std::atomic<bool> spilling_;
+  std::unique_ptr<arrow::internal::TemporaryDir> spill_dir_;
+  HashPartitionedSpill probe_spill_;
+  HashPartitionedSpill build_spill_;
+
+  // The SwissJoin of a spilled partition and the scheduler that runs its tasks
+  struct SpilledPartitionJoin {
+    std::unique_ptr<HashJoinImpl> impl;
+    std::unique_ptr<TaskScheduler> scheduler;
+  };
+
+  struct {
+    std::mutex mutex;
+    int partition = -1;
+    // The partition being joined.  Its running tasks share ownership of it, so it
+    // outlives this reference until they have all returned.
+    std::shared_ptr<SpilledPartitionJoin> current;
+    std::mutex probe_file_mutex;
+    int64_t num_output_batches = 0;
+  } spilled_join_;
+
+  // Runtime filters list the values of a key if there are at most this many, and only
+  // look for them if the build side is small
+  static constexpr int64_t kMaxRuntimeFilterValues = 64;
+  static constexpr int64_t kMaxRuntimeFilterInListBuildRows = 4096;
+
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
   BloomFilterPushdownContext pushdown_context_;
@@ -1074,7 +1445,7 @@ Status BloomFilterPushdownContext::Init(
   eval_.all_received_callback_ = std::move(on_bloom_filters_received);
   if (!disable_bloom_filter_) {
     ARROW_CHECK(push_.pushdown_target_);
-    push_.bloom_filter_ = std::make_unique<BlockedBloomFilter>();
+    push_.bloom_filter_ = std::make_shared<BlockedBloomFilter>();
     push_.pushdown_target_->pushdown_context_.ExpectBloomFilter();
 
     build_.builder_ = BloomFilterBuilder::Make(
@@ -1137,6 +1508,14 @@ Status BloomFilterPushdownContext::PushBloomFilter(size_t thread_index) {
   return Status::OK();
 }
 
+Status BloomFilterPushdownContext::SkipBloomFilter(size_t thread_index) {
+  if (disable_bloom_filter_) return Status::OK();
+  disable_bloom_filter_ = true;
+  push_.bloom_filter_.reset();
+  return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
+      thread_index, /*filter=*/nullptr, /*column_map=*/{});
+}
+
 Status BloomFilterPushdownContext::BuildBloomFilter_exec_task(size_t thread_index,
                                                               int64_t task_id) {
   const ExecBatch& input_batch = build_.batches_[task_id];
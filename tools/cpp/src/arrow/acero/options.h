@@ -103,6 +103,12 @@ class ARROW_ACERO_EXPORT SourceNodeOptions : public ExecNodeOptions {
   std::function<Future<std::optional<ExecBatch>>()> generator;
   /// \brief the order of the data, defaults to Ordering::Unordered
   Ordering ordering;
+  /// \brief where to keep runtime filters that joins push into this source
+  ///
+  /// If set, the source drops rows that the filters rule out.  The code producing
+  /// `generator` may also consult the filters to avoid reading data at all.  \see
+  /// ExecNode::PushRuntimeFilter
+  std::shared_ptr<RuntimeFilterSet> runtime_filters;
 };
 
 /// \brief a node that generates data from a table already loaded in memory
@@ -533,16 +539,56 @@ class ARROW_ACERO_EXPORT OrderBySinkNodeOptions : public SinkNodeOptions {
 /// \brief Apply a new ordering to data
 ///
 /// Currently this node works by accumulating all data, sorting, and then emitting
-/// the new data with an updated batch index.
+/// the new data with an updated batch index.  Large inputs are sorted in runs as
+/// they arrive and the runs are merged at the end.
 ///
-/// Larger-than-memory sort is not currently supported.
+/// Larger-than-memory sort is supported through QueryOptions::spill_memory_limit.
 class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
  public:
   static constexpr std::string_view kName = "order_by";
-  explicit OrderByNodeOptions(Ordering ordering) : ordering(std::move(ordering)) {}
+  static constexpr int64_t kDefaultSortRunLength = 512 * 1024;
+
+  explicit OrderByNodeOptions(Ordering ordering,
+                              int64_t sort_run_length = kDefaultSortRunLength)
+      : ordering(std::move(ordering)), sort_run_length(sort_run_length) {}
 
   /// \brief The new ordering to apply to outgoing data
   Ordering ordering;
+  /// \brief Number of rows that are sorted together as one run
+  ///
+  /// Inputs of more rows than this are sorted in runs of this many rows, on the
+  /// threads that deliver them, and the runs are merged at the end.  Inputs of only
+  /// a few runs are sorted at once instead, as is any input if this is zero.
+  int64_t sort_run_length;
+};
+
+/// \brief Keep the first `k` rows of the data in an ordering, optionally per group
+///
+/// This is equivalent to an order_by node followed by a fetch node (per group) but
+/// it never holds more than about `k` candidate rows per group and thread: rows
+/// that cannot be among the first `k` are discarded as the data arrives.
+///
+/// The output is sorted by `ordering` within each group.  The groups are emitted one
+/// after the other in no particular order, so the output ordering is implicit when
+/// there are keys.
+class ARROW_ACERO_EXPORT TopKNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "top_k";
+  TopKNodeOptions(Ordering ordering, int64_t k, bool with_ties = false,
+                  std::vector<FieldRef> keys = {})
+      : ordering(std::move(ordering)),
+        k(k),
+        with_ties(with_ties),
+        keys(std::move(keys)) {}
+
+  /// \brief The ordering that decides which rows come first
+  Ordering ordering;
+  /// \brief The number of rows to keep per group
+  int64_t k;
+  /// \brief Whether to also keep the rows that tie with the k-th row of their group
+  bool with_ties;
+  /// \brief The keys of the groups, none to select from all of the data
+  std::vector<FieldRef> keys;
 };
 
 enum class JoinType {
@@ -737,6 +783,76 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
   int64_t tolerance;
 };
 
+/// \brief How the left column of a range join condition compares to the right column
+enum class JoinRangeCmp { LT, LE, GT, GE };
+
+/// \brief A condition `left <cmp> right` between a left and a right column of a join
+struct ARROW_ACERO_EXPORT JoinRangeCondition {
+  /// \brief The column of the left input
+  FieldRef left;
+  /// \brief How the left column compares to the right column in a matching pair
+  JoinRangeCmp cmp;
+  /// \brief The column of the right input
+  FieldRef right;
+};
+
+/// \brief a node which joins rows on inequality conditions, and optionally equal keys
+///
+/// A left row and a right row match if they are equal in the keys (as in a hash join)
+/// and satisfy all of the conditions.  Intervals are joined with two conditions,
+/// e.g. `left.ts >= right.start` and `left.ts < right.end`.
+///
+/// The right input is collected and sorted by the keys and by the right column of
+/// the first condition.  Each left row then finds the right rows that satisfy the
+/// first condition by binary search, and checks only those against the other
+/// conditions, so no cross product is formed.  If another condition bounds the right
+/// rows from the other side (as the end of an interval does when the first condition
+/// is on its start), the scan stops once no remaining row can satisfy it.
+///
+/// Nulls and NaNs never satisfy a condition.  The columns of a condition must both
+/// be numeric, both be of the same temporal type, or both be binary or string.
+class ARROW_ACERO_EXPORT RangeJoinNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "range_join";
+  RangeJoinNodeOptions(
+      JoinType join_type, std::vector<FieldRef> left_keys,
+      std::vector<FieldRef> right_keys, std::vector<JoinRangeCondition> conditions,
+      std::vector<FieldRef> left_output, std::vector<FieldRef> right_output,
+      std::vector<JoinKeyCmp> key_cmp = {},
+      std::string output_suffix_for_left =
+          HashJoinNodeOptions::default_output_suffix_for_left,
+      std::string output_suffix_for_right =
+          HashJoinNodeOptions::default_output_suffix_for_right)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)),
+        conditions(std::move(conditions)),
+        left_output(std::move(left_output)),
+        right_output(std::move(right_output)),
+        key_cmp(std::move(key_cmp)),
+        output_suffix_for_left(std::move(output_suffix_for_left)),
+        output_suffix_for_right(std::move(output_suffix_for_right)) {}
+
+  /// \brief The type of join (inner, left, semi...)
+  JoinType join_type;
+  /// \brief The key fields of the left input, compared for equality
+  std::vector<FieldRef> left_keys;
+  /// \brief The key fields of the right input, compared for equality
+  std::vector<FieldRef> right_keys;
+  /// \brief The conditions that a matching pair of rows satisfies, at least one
+  std::vector<JoinRangeCondition> conditions;
+  /// \brief The fields of the left input to output
+  std::vector<FieldRef> left_output;
+  /// \brief The fields of the right input to output
+  std::vector<FieldRef> right_output;
+  /// \brief How each pair of keys is compared, EQ for all keys if empty
+  std::vector<JoinKeyCmp> key_cmp;
+  /// \brief Suffix added to the names of left output fields that are also on the right
+  std::string output_suffix_for_left;
+  /// \brief Suffix added to the names of right output fields that are also on the left
+  std::string output_suffix_for_right;
+};
+
 /// \brief a node which select top_k/bottom_k rows passed through it
 ///
 /// All batches pushed to this node will be accumulated, then selected, by the given
@@ -868,6 +984,77 @@ class ARROW_ACERO_EXPORT PivotLongerNodeOptions : public ExecNodeOptions {
   std::vector<std::string> measurement_field_names;
 };
 
+/// \brief The rows of its partition that a window aggregate is computed over
+///
+/// In ROWS mode the frame of a row extends `preceding` rows before it and `following`
+/// rows after it.  In RANGE mode it extends over the rows whose order key lies within
+/// `preceding` below and `following` above the row's own key, so rows with equal keys
+/// (peers) always share a frame.  Non-zero RANGE offsets need a single numeric order
+/// key.  A bound that is not set extends to the edge of the partition.
+struct ARROW_ACERO_EXPORT WindowFrame {
+  enum Units { ROWS, RANGE };
+
+  /// \brief The whole partition, the frame used by default
+  static WindowFrame Unbounded() { return {}; }
+  /// \brief From the start of the partition up to the current row (and its peers in
+  /// RANGE mode), as for a running total
+  static WindowFrame Cumulative(Units units = ROWS) { return {units, std::nullopt, 0}; }
+
+  Units units = ROWS;
+  std::optional<int64_t> preceding;
+  std::optional<int64_t> following;
+};
+
+/// \brief A value computed for each row from the rows of its partition
+struct ARROW_ACERO_EXPORT WindowFunction {
+  /// \brief The function to compute, one of
+  ///
+  /// - "row_number": the 1-based position of the row in its partition
+  /// - "lag" and "lead": the target of the row PairwiseOptions::periods rows before or
+  ///   after the current row in the partition, or null if there is none
+  /// - a vector function such as "cumulative_sum" or "rank": called on the targets of
+  ///   each partition in order, it must return one value for each row
+  /// - a scalar aggregate function such as "sum" or "mean": computed over the frame
+  ///   of each row with its "hash_" counterpart
+  std::string function;
+  /// \brief Options for the function, or null for its defaults
+  std::shared_ptr<compute::FunctionOptions> options;
+  /// \brief Zero or more fields the function is applied to
+  std::vector<FieldRef> target;
+  /// \brief The name of the output column, defaults to the function name
+  std::string name;
+  /// \brief The rows an aggregate function is computed over, ignored by the others
+  WindowFrame frame;
+};
+
+/// \brief Make a node which computes window functions
+///
+/// The rows are partitioned by the values of `partition_keys` and each partition is
+/// ordered by `ordering`.  Without an ordering, the rows of a partition stay in the
+/// order in which they arrived, which is only deterministic if the input is ordered.
+///
+/// This node is a pipeline breaker.  It accumulates all input, then outputs the
+/// input batches, in order if the input is ordered, with one column appended for
+/// each window function.  Aggregates over whole partitions do not need the rows to
+/// be sorted, so they are computed in a single pass over the input.
+class ARROW_ACERO_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "window";
+  explicit WindowNodeOptions(std::vector<WindowFunction> functions,
+                             std::vector<FieldRef> partition_keys = {},
+                             Ordering ordering = Ordering::Unordered())
+      : functions(std::move(functions)),
+        partition_keys(std::move(partition_keys)),
+        ordering(std::move(ordering)) {}
+
+  /// \brief The window functions to compute
+  std::vector<WindowFunction> functions;
+  /// \brief The keys which partition the rows (optional)
+  std::vector<FieldRef> partition_keys;
+  /// \brief The order of the rows within each partition (optional)
+  Ordering ordering;
+};
+
 /// @}
 
 }  // namespace acero
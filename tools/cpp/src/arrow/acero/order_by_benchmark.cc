@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace arrow {
+
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+
+constexpr auto kSeed = 0x0ff1ce;
+constexpr int64_t kBatchSize = 32 * 1024;
+
+static std::shared_ptr<Table> MakeSortInput(int64_t num_rows) {
+  random::RandomArrayGenerator rng(kSeed);
+  auto schema = arrow::schema({field("i64", int64()), field("str", utf8()),
+                               field("payload", float64())});
+  ArrayVector columns = {
+      rng.Int64(num_rows, -1000000, 1000000, /*null_probability=*/0.01),
+      rng.String(num_rows, /*min_length=*/4, /*max_length=*/12,
+                 /*null_probability=*/0.01),
+      rng.Float64(num_rows, 0, 1)};
+  auto batch = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return *Table::FromRecordBatches({batch});
+}
+
+// Sorts with the order_by node.  Inputs of more than kSortRunLength rows are sorted
+// in runs on the threads that deliver them and merged at the end.
+static void OrderByBenchmark(benchmark::State& state, std::vector<SortKey> sort_keys) {
+  const int64_t num_rows = state.range(0);
+  const bool use_threads = state.range(1) != 0;
+  const int64_t spill_memory_limit = state.range(2);
+  std::shared_ptr<Table> input = MakeSortInput(num_rows);
+
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input, kBatchSize)},
+       {"order_by", OrderByNodeOptions(Ordering(std::move(sort_keys)))}});
+  QueryOptions query_options;
+  query_options.use_threads = use_threads;
+  query_options.spill_memory_limit = spill_memory_limit;
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto sorted, DeclarationToTable(plan, query_options));
+    benchmark::DoNotOptimize(sorted);
+  }
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void SetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"num_rows", "use_threads", "spill_memory_limit"})->UseRealTime();
+  for (int64_t num_rows : {1 << 16, 1 << 20, 1 << 23}) {
+    for (int64_t use_threads : {0, 1}) {
+      bench->Args({num_rows, use_threads, 0});
+    }
+  }
+  bench->Args({1 << 23, 1, 64 << 20});
+}
+
+BENCHMARK_CAPTURE(OrderByBenchmark, Int64, {SortKey("i64")})->Apply(SetArgs);
+BENCHMARK_CAPTURE(OrderByBenchmark, StringDescInt64,
+                  {SortKey("str", SortOrder::Descending), SortKey("i64")})
+    ->Apply(SetArgs);
+
+}  // namespace acero
+}  // namespace arrow
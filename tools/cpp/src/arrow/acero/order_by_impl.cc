@@ -17,23 +17,38 @@
 
 #include "arrow/acero/order_by_impl.h"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <vector>
+#include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/array.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/row/grouper.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/visit_type_inline.h"
 
 namespace arrow {
 
 using internal::checked_cast;
 
+using compute::ExecSpan;
+using compute::NullPlacement;
+using compute::SortKey;
+using compute::SortOrder;
 using compute::TakeOptions;
 
 namespace acero {
@@ -42,19 +57,66 @@ class SortBasicImpl : public OrderByImpl {
  public:
   SortBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
                 const SortOptions& options = SortOptions{})
-      : ctx_(ctx), output_schema_(output_schema), options_(options) {}
+      : ctx_(ctx), output_schema_(output_schema), options_(options) {
+    if (!options_.sort_keys.empty() &&
+        SortedRunMerger::CanMerge(*output_schema_, ordering())) {
+      run_length_ = kSortRunLength;
+    }
+  }
 
   void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    std::vector<std::shared_ptr<RecordBatch>> run;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      batches_.push_back(batch);
+      num_rows_ += batch->num_rows();
+      if (run_length_ == 0 ||
+          num_rows_ < (num_runs_ == 0 ? kMinMergedRuns : 1) * run_length_) {
+        return;
+      }
+      run.swap(batches_);
+      num_rows_ = 0;
+      ++num_runs_;
+    }
+    // Sorted outside of the lock so that threads can sort runs in parallel.  Errors
+    // are reported by DoFinish.
+    auto maybe_sorted = Sort(std::move(run));
     std::unique_lock<std::mutex> lock(mutex_);
-    batches_.push_back(batch);
+    if (!maybe_sorted.ok()) {
+      status_ &= maybe_sorted.status();
+      return;
+    }
+    sorted_runs_.push_back(maybe_sorted.MoveValueUnsafe());
   }
 
   Result<Datum> DoFinish() override {
     std::unique_lock<std::mutex> lock(mutex_);
-    ARROW_ASSIGN_OR_RAISE(auto table,
-                          Table::FromRecordBatches(output_schema_, std::move(batches_)));
-    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
-    return Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_);
+    RETURN_NOT_OK(status_);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted, Sort(std::move(batches_)));
+    if (sorted_runs_.empty()) {
+      return sorted;
+    }
+
+    std::vector<SortedRunMerger::RunReader> readers;
+    sorted_runs_.push_back(std::move(sorted));
+    for (const auto& run : sorted_runs_) {
+      auto reader = std::make_shared<TableBatchReader>(run);
+      readers.push_back([reader]() { return reader->Next(); });
+    }
+    ARROW_ASSIGN_OR_RAISE(auto merger,
+                          SortedRunMerger::Make(ctx_, output_schema_, ordering(),
+                                                std::move(readers)));
+    RecordBatchVector merged;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch,
+                            merger->Next(ExecPlan::kMaxBatchSize));
+      if (!batch) {
+        break;
+      }
+      merged.push_back(std::move(batch));
+    }
+    sorted_runs_.clear();
+    return Table::FromRecordBatches(output_schema_, std::move(merged));
   }
 
   std::string ToString() const override { return options_.ToString(); }
@@ -64,9 +126,28 @@ class SortBasicImpl : public OrderByImpl {
   std::shared_ptr<Schema> output_schema_;
   std::mutex mutex_;
   std::vector<std::shared_ptr<RecordBatch>> batches_;
+  int64_t num_rows_ = 0;
+  Status status_;
 
  private:
+  Ordering ordering() const {
+    return Ordering(options_.sort_keys, options_.null_placement);
+  }
+
+  Result<std::shared_ptr<Table>> Sort(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return sorted.table();
+  }
+
   const SortOptions options_;
+  // Runs are only sorted separately if run_length_ is nonzero
+  int64_t run_length_ = 0;
+  int64_t num_runs_ = 0;
+  std::vector<std::shared_ptr<Table>> sorted_runs_;
 };  // namespace compute
 
 class SelectKBasicImpl : public SortBasicImpl {
@@ -75,8 +156,37 @@ class SelectKBasicImpl : public SortBasicImpl {
                    const SelectKOptions& options)
       : SortBasicImpl(ctx, output_schema), options_(options) {}
 
+  // The first k rows of the whole input are among the first k rows of any part of it
+  // that contains them, so the buffered rows are replaced by their first k rows
+  // whenever there are enough of them.  This bounds the memory held to about
+  // k rows per thread.
+  void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    std::vector<std::shared_ptr<RecordBatch>> buffered;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      batches_.push_back(batch);
+      num_rows_ += batch->num_rows();
+      if (num_rows_ < std::max(kTopKBufferRows, 2 * options_.k)) {
+        return;
+      }
+      buffered.swap(batches_);
+      num_rows_ = 0;
+    }
+    // Selected outside of the lock so that threads can select in parallel.  Errors
+    // are reported by DoFinish.
+    auto maybe_selected = SelectK(std::move(buffered));
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!maybe_selected.ok()) {
+      status_ &= maybe_selected.status();
+      return;
+    }
+    num_rows_ += (*maybe_selected)->num_rows();
+    batches_.push_back(maybe_selected.MoveValueUnsafe());
+  }
+
   Result<Datum> DoFinish() override {
     std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(status_);
     ARROW_ASSIGN_OR_RAISE(auto table,
                           Table::FromRecordBatches(output_schema_, std::move(batches_)));
     ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
@@ -86,9 +196,536 @@ class SelectKBasicImpl : public SortBasicImpl {
   std::string ToString() const override { return options_.ToString(); }
 
  private:
+  Result<std::shared_ptr<RecordBatch>> SelectK(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum selected,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return selected.table()->CombineChunksToBatch(ctx_->memory_pool());
+  }
+
   const SelectKOptions options_;
 };
 
+namespace {
+
+// Compares a value of one array with a value of another array of the same type
+class RunColumnComparator {
+ public:
+  RunColumnComparator(SortOrder order, NullPlacement null_placement)
+      : order_(order), null_placement_(null_placement) {}
+  virtual ~RunColumnComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t left_index, const Array& right,
+                      int64_t right_index) const = 0;
+
+ protected:
+  // Nulls (and NaNs) are placed according to null_placement_ whatever the order
+  int CompareNullness(bool left_is_null, bool right_is_null) const {
+    if (left_is_null && right_is_null) {
+      return 0;
+    }
+    const bool nulls_first = null_placement_ == NullPlacement::AtStart;
+    return left_is_null == nulls_first ? -1 : 1;
+  }
+
+  SortOrder order_;
+  NullPlacement null_placement_;
+};
+
+template <typename Type>
+class ConcreteRunColumnComparator : public RunColumnComparator {
+ public:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using RunColumnComparator::RunColumnComparator;
+
+  int Compare(const Array& left, int64_t left_index, const Array& right,
+              int64_t right_index) const override {
+    const bool left_is_null = left.IsNull(left_index);
+    const bool right_is_null = right.IsNull(right_index);
+    if (left_is_null || right_is_null) {
+      return CompareNullness(left_is_null, right_is_null);
+    }
+    const auto& left_array = checked_cast<const ArrayType&>(left);
+    const auto& right_array = checked_cast<const ArrayType&>(right);
+    auto left_value = GetValue(left_array, left_index);
+    auto right_value = GetValue(right_array, right_index);
+    if constexpr (is_floating_type<Type>::value) {
+      const bool left_is_nan = std::isnan(left_value);
+      const bool right_is_nan = std::isnan(right_value);
+      if (left_is_nan || right_is_nan) {
+        return CompareNullness(left_is_nan, right_is_nan);
+      }
+    }
+    int compared = left_value == right_value ? 0 : (left_value < right_value ? -1 : 1);
+    return order_ == SortOrder::Descending ? -compared : compared;
+  }
+
+ private:
+  static auto GetValue(const ArrayType& array, int64_t index) {
+    if constexpr (is_decimal_type<Type>::value) {
+      return typename TypeTraits<Type>::CType(array.GetValue(index));
+    } else {
+      return array.GetView(index);
+    }
+  }
+};
+
+struct RunColumnComparatorFactory {
+  template <typename Type>
+  enable_if_t<is_number_type<Type>::value || is_temporal_type<Type>::value ||
+                  is_boolean_type<Type>::value || is_base_binary_type<Type>::value ||
+                  is_binary_view_like_type<Type>::value ||
+                  is_fixed_size_binary_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    if constexpr (is_half_float_type<Type>::value || is_interval_type<Type>::value) {
+      return Unsupported();
+    } else {
+      out = std::make_unique<ConcreteRunColumnComparator<Type>>(order, null_placement);
+      return Status::OK();
+    }
+  }
+
+  Status Visit(const DataType&) { return Unsupported(); }
+
+  Status Unsupported() {
+    return Status::NotImplemented("Merging sorted runs on a sort key of type ",
+                                  type->ToString());
+  }
+
+  const std::shared_ptr<DataType>& type;
+  SortOrder order;
+  NullPlacement null_placement;
+  std::unique_ptr<RunColumnComparator> out;
+};
+
+Result<std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>>>
+MakeRunComparators(const Schema& schema, const Ordering& ordering) {
+  std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>> comparators;
+  for (const SortKey& sort_key : ordering.sort_keys()) {
+    ARROW_ASSIGN_OR_RAISE(FieldPath path, sort_key.target.FindOne(schema));
+    if (path.indices().size() != 1) {
+      return Status::NotImplemented("Merging sorted runs on a nested sort key");
+    }
+    const std::shared_ptr<DataType>& type = schema.field(path[0])->type();
+    RunColumnComparatorFactory factory{type, sort_key.order, ordering.null_placement(),
+                                       nullptr};
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    comparators.emplace_back(path[0], std::move(factory.out));
+  }
+  return comparators;
+}
+
+class SortedRunMergerImpl : public SortedRunMerger {
+ public:
+  SortedRunMergerImpl(
+      ExecContext* ctx, std::shared_ptr<Schema> schema,
+      std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>> comparators,
+      std::vector<RunReader> readers)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        comparators_(std::move(comparators)),
+        heap_(RunAfter{this}) {
+    runs_.resize(readers.size());
+    for (size_t i = 0; i < readers.size(); ++i) {
+      runs_[i].reader = std::move(readers[i]);
+    }
+  }
+
+  Status Init() {
+    for (int i = 0; i < static_cast<int>(runs_.size()); ++i) {
+      ARROW_ASSIGN_OR_RAISE(bool has_rows, LoadNextBatch(&runs_[i]));
+      if (has_rows) {
+        heap_.push(i);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next(int64_t max_rows) override {
+    // The rows are gathered with a single Take from the slices of the current batches
+    // of the runs that they come from, so that only as many rows as are output get
+    // concatenated.  Each row is first indexed within its slice, then within them all.
+    std::vector<Slice> slices;
+    std::vector<int> row_slices;
+    std::vector<uint64_t> indices;
+    row_slices.reserve(max_rows);
+    indices.reserve(max_rows);
+    while (static_cast<int64_t>(indices.size()) < max_rows && !heap_.empty()) {
+      int run_index = heap_.top();
+      Run& run = runs_[run_index];
+      heap_.pop();
+      if (run.slice < 0) {
+        run.slice = static_cast<int>(slices.size());
+        slices.push_back({run.batch, run.position, run.position});
+      }
+      Slice& slice = slices[run.slice];
+      row_slices.push_back(run.slice);
+      indices.push_back(static_cast<uint64_t>(run.position - slice.start));
+      slice.end = ++run.position;
+      if (run.position == run.batch->num_rows()) {
+        run.slice = -1;
+        ARROW_ASSIGN_OR_RAISE(bool has_rows, LoadNextBatch(&run));
+        if (!has_rows) {
+          continue;
+        }
+      }
+      heap_.push(run_index);
+    }
+    for (Run& run : runs_) {
+      run.slice = -1;
+    }
+    if (indices.empty()) {
+      return nullptr;
+    }
+
+    RecordBatchVector batches;
+    std::vector<uint64_t> slice_offsets;
+    uint64_t num_rows = 0;
+    for (const Slice& slice : slices) {
+      batches.push_back(slice.batch->Slice(slice.start, slice.end - slice.start));
+      slice_offsets.push_back(num_rows);
+      num_rows += slice.end - slice.start;
+    }
+    for (size_t i = 0; i < indices.size(); ++i) {
+      indices[i] += slice_offsets[row_slices[i]];
+    }
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, batches));
+    auto take_indices = std::make_shared<UInt64Array>(
+        static_cast<int64_t>(indices.size()), Buffer::FromVector(std::move(indices)));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum taken, Take(table, take_indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return taken.table()->CombineChunksToBatch(ctx_->memory_pool());
+  }
+
+ private:
+  struct Run {
+    RunReader reader;
+    std::shared_ptr<RecordBatch> batch;
+    // The sort key columns of `batch`, in the order of comparators_
+    std::vector<const Array*> sort_columns;
+    int64_t position = 0;
+    // Index of the slice of `batch` among those gathered by the current call to Next,
+    // or -1 if no row of it has been gathered yet
+    int slice = -1;
+  };
+
+  struct Slice {
+    std::shared_ptr<RecordBatch> batch;
+    int64_t start;
+    int64_t end;
+  };
+
+  // Orders the heap so that the run with the smallest current row is on top
+  struct RunAfter {
+    bool operator()(int left, int right) const {
+      const Run& left_run = merger->runs_[left];
+      const Run& right_run = merger->runs_[right];
+      for (size_t i = 0; i < merger->comparators_.size(); ++i) {
+        int compared = merger->comparators_[i].second->Compare(
+            *left_run.sort_columns[i], left_run.position, *right_run.sort_columns[i],
+            right_run.position);
+        if (compared != 0) {
+          return compared > 0;
+        }
+      }
+      return left > right;
+    }
+    SortedRunMergerImpl* merger;
+  };
+
+  Result<bool> LoadNextBatch(Run* run) {
+    do {
+      ARROW_ASSIGN_OR_RAISE(run->batch, run->reader());
+    } while (run->batch && run->batch->num_rows() == 0);
+    run->position = 0;
+    run->sort_columns.clear();
+    if (run->batch) {
+      // The batch keeps its columns alive
+      for (const auto& [column, comparator] : comparators_) {
+        run->sort_columns.push_back(run->batch->column(column).get());
+      }
+    }
+    return run->batch != nullptr;
+  }
+
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>> comparators_;
+  std::vector<Run> runs_;
+  std::priority_queue<int, std::vector<int>, RunAfter> heap_;
+};
+
+class TopKSelectorImpl : public TopKSelector {
+ public:
+  TopKSelectorImpl(
+      ExecContext* ctx, std::shared_ptr<Schema> schema, Ordering ordering, int64_t k,
+      bool with_ties, std::vector<int> key_ids, std::vector<int> sort_columns,
+      std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>> comparators,
+      size_t num_threads)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        ordering_(std::move(ordering)),
+        k_(k),
+        with_ties_(with_ties),
+        key_ids_(std::move(key_ids)),
+        sort_columns_(std::move(sort_columns)),
+        comparators_(std::move(comparators)),
+        states_(num_threads) {}
+
+  Status Consume(size_t thread_index,
+                 const std::shared_ptr<RecordBatch>& batch) override {
+    if (k_ == 0 || batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    ThreadState& state = states_[thread_index];
+    std::shared_ptr<RecordBatch> rows = batch;
+    if (key_ids_.empty() && !comparators_.empty() && state.candidates &&
+        state.candidates->num_rows() >= k_) {
+      ARROW_ASSIGN_OR_RAISE(rows, DropRowsAfter(*state.candidates, k_ - 1, batch));
+      if (rows->num_rows() == 0) {
+        return Status::OK();
+      }
+    }
+    state.buffered_rows += rows->num_rows();
+    state.buffered.push_back(std::move(rows));
+    int64_t num_candidates = state.candidates ? state.candidates->num_rows() : 0;
+    if (state.buffered_rows < std::max(kTopKBufferRows, num_candidates)) {
+      return Status::OK();
+    }
+    if (state.candidates) {
+      state.buffered.push_back(std::move(state.candidates));
+    }
+    ARROW_ASSIGN_OR_RAISE(state.candidates, Select(std::move(state.buffered)));
+    state.buffered.clear();
+    state.buffered_rows = 0;
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Table>> Finish() override {
+    RecordBatchVector batches;
+    for (ThreadState& state : states_) {
+      if (state.candidates) {
+        batches.push_back(std::move(state.candidates));
+      }
+      for (auto& batch : state.buffered) {
+        batches.push_back(std::move(batch));
+      }
+      state = ThreadState{};
+    }
+    if (batches.empty()) {
+      return Table::MakeEmpty(schema_, ctx_->memory_pool());
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> selected,
+                          Select(std::move(batches)));
+    return Table::FromRecordBatches(schema_, {std::move(selected)});
+  }
+
+ private:
+  struct ThreadState {
+    // The rows selected so far, sorted like the output
+    std::shared_ptr<RecordBatch> candidates;
+    RecordBatchVector buffered;
+    int64_t buffered_rows = 0;
+  };
+
+  // Compares row `left` of `left_batch` with row `right` of `right_batch` by the
+  // ordering
+  int CompareRows(const RecordBatch& left_batch, int64_t left,
+                  const RecordBatch& right_batch, int64_t right) const {
+    for (const auto& [column, comparator] : comparators_) {
+      int compared = comparator->Compare(*left_batch.column(column), left,
+                                         *right_batch.column(column), right);
+      if (compared != 0) {
+        return compared;
+      }
+    }
+    return 0;
+  }
+
+  // Whether two rows of a batch have the same values in the sort keys
+  bool Tied(const RecordBatch& batch, int64_t left, int64_t right) const {
+    if (!comparators_.empty()) {
+      // The comparators do not tell NaNs from nulls
+      for (int column : sort_columns_) {
+        if (batch.column(column)->IsNull(left) != batch.column(column)->IsNull(right)) {
+          return false;
+        }
+      }
+      return CompareRows(batch, left, batch, right) == 0;
+    }
+    for (int column : sort_columns_) {
+      const Array& array = *batch.column(column);
+      auto left_value = array.GetScalar(left);
+      auto right_value = array.GetScalar(right);
+      if (!left_value.ok() || !right_value.ok() ||
+          !(*left_value)->Equals(**right_value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Drops the rows of `batch` that sort after row `last` of `candidates`.  Rows that
+  // compare equal are kept: they may be ties, and the comparators do not tell NaNs
+  // from nulls.
+  Result<std::shared_ptr<RecordBatch>> DropRowsAfter(
+      const RecordBatch& candidates, int64_t last,
+      const std::shared_ptr<RecordBatch>& batch) const {
+    UInt64Builder kept(ctx_->memory_pool());
+    RETURN_NOT_OK(kept.Reserve(batch->num_rows()));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      if (CompareRows(*batch, i, candidates, last) <= 0) {
+        kept.UnsafeAppend(static_cast<uint64_t>(i));
+      }
+    }
+    if (kept.length() == batch->num_rows()) {
+      return batch;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, kept.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum taken,
+                          Take(batch, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return taken.record_batch();
+  }
+
+  // Returns the first k rows of each group (and their ties) of the given rows,
+  // sorted by group and then by the ordering
+  Result<std::shared_ptr<RecordBatch>> Select(RecordBatchVector batches) const {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> rows,
+                          table->CombineChunksToBatch(ctx_->memory_pool()));
+
+    // The rows are sorted by group id first, so that each group is contiguous
+    std::vector<SortKey> sort_keys = ordering_.sort_keys();
+    std::shared_ptr<RecordBatch> to_sort = rows;
+    const uint32_t* group_ids = nullptr;
+    std::shared_ptr<Array> group_id_array;
+    if (!key_ids_.empty()) {
+      std::vector<TypeHolder> key_types;
+      std::vector<Datum> key_columns;
+      for (int key_id : key_ids_) {
+        key_types.emplace_back(schema_->field(key_id)->type());
+        key_columns.emplace_back(rows->column(key_id));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto grouper, compute::Grouper::Make(key_types, ctx_));
+      ExecBatch keys(std::move(key_columns), rows->num_rows());
+      ARROW_ASSIGN_OR_RAISE(Datum ids, grouper->Consume(ExecSpan(keys)));
+      group_id_array = ids.make_array();
+      group_ids = group_id_array->data()->GetValues<uint32_t>(1);
+      const int group_column = rows->num_columns();
+      ARROW_ASSIGN_OR_RAISE(
+          to_sort, rows->AddColumn(group_column, field("__group_id", uint32()),
+                                   group_id_array));
+      sort_keys.insert(sort_keys.begin(), SortKey(FieldRef(group_column)));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto sorted,
+        SortIndices(Datum(to_sort), SortOptions(sort_keys, ordering_.null_placement()),
+                    ctx_));
+    const uint64_t* sorted_rows = sorted->data()->GetValues<uint64_t>(1);
+
+    UInt64Builder selected(ctx_->memory_pool());
+    RETURN_NOT_OK(selected.Reserve(std::min(rows->num_rows(), k_)));
+    uint32_t group = 0;
+    int64_t rank = 0;
+    // The k-th row of the group, once the group has that many
+    int64_t last = -1;
+    // Whether the rest of the group is past the k-th row and its ties
+    bool group_done = false;
+    for (int64_t i = 0; i < rows->num_rows(); ++i) {
+      const auto row = static_cast<int64_t>(sorted_rows[i]);
+      if (group_ids && group_ids[row] != group) {
+        group = group_ids[row];
+        rank = 0;
+        last = -1;
+        group_done = false;
+      }
+      if (group_done) {
+        continue;
+      }
+      if (rank < k_) {
+        RETURN_NOT_OK(selected.Append(static_cast<uint64_t>(row)));
+        if (++rank == k_) {
+          last = row;
+        }
+      } else if (with_ties_ && Tied(*rows, row, last)) {
+        RETURN_NOT_OK(selected.Append(static_cast<uint64_t>(row)));
+      } else {
+        group_done = true;
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, selected.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum taken,
+                          Take(rows, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return taken.record_batch();
+  }
+
+  ExecContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  Ordering ordering_;
+  int64_t k_;
+  bool with_ties_;
+  std::vector<int> key_ids_;
+  std::vector<int> sort_columns_;
+  // Empty if the sort keys cannot be compared, in which case rows are not dropped
+  // before they are buffered and ties are found by comparing scalars
+  std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>> comparators_;
+  std::vector<ThreadState> states_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<SortedRunMerger>> SortedRunMerger::Make(
+    ExecContext* ctx, std::shared_ptr<Schema> schema, const Ordering& ordering,
+    std::vector<RunReader> runs) {
+  ARROW_ASSIGN_OR_RAISE(auto comparators, MakeRunComparators(*schema, ordering));
+  auto merger = std::make_unique<SortedRunMergerImpl>(
+      ctx, std::move(schema), std::move(comparators), std::move(runs));
+  RETURN_NOT_OK(merger->Init());
+  return merger;
+}
+
+bool SortedRunMerger::CanMerge(const Schema& schema, const Ordering& ordering) {
+  return MakeRunComparators(schema, ordering).ok();
+}
+
+Result<std::unique_ptr<TopKSelector>> TopKSelector::Make(
+    ExecContext* ctx, std::shared_ptr<Schema> schema, Ordering ordering, int64_t k,
+    bool with_ties, std::vector<FieldRef> keys, size_t num_threads) {
+  if (k < 0) {
+    return Status::Invalid("TopKSelector: k must be non-negative, got ", k);
+  }
+  std::vector<int> key_ids;
+  for (const FieldRef& key : keys) {
+    ARROW_ASSIGN_OR_RAISE(FieldPath path, key.FindOne(*schema));
+    if (path.indices().size() != 1) {
+      return Status::NotImplemented("TopKSelector: nested group key ", key.ToString());
+    }
+    key_ids.push_back(path[0]);
+  }
+  std::vector<int> sort_columns;
+  for (const SortKey& sort_key : ordering.sort_keys()) {
+    ARROW_ASSIGN_OR_RAISE(FieldPath path, sort_key.target.FindOne(*schema));
+    if (path.indices().size() != 1) {
+      return Status::NotImplemented("TopKSelector: nested sort key ",
+                                    sort_key.target.ToString());
+    }
+    sort_columns.push_back(path[0]);
+  }
+  std::vector<std::pair<int, std::unique_ptr<RunColumnComparator>>> comparators;
+  auto maybe_comparators = MakeRunComparators(*schema, ordering);
+  if (maybe_comparators.ok()) {
+    comparators = maybe_comparators.MoveValueUnsafe();
+  }
+  return std::make_unique<TopKSelectorImpl>(
+      ctx, std::move(schema), std::move(ordering), k, with_ties, std::move(key_ids),
+      std::move(sort_columns), std::move(comparators), num_threads);
+}
+
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
     ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
     const SortOptions& options) {
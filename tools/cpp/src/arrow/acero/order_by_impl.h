@@ -52,5 +52,84 @@ class OrderByImpl {
       const SelectKOptions& options);
 };
 
+/// \brief Number of rows that are sorted together as one run
+///
+/// Sorts of more rows than this sort runs of this many rows as the input arrives,
+/// which spreads the sorting over the threads delivering the input, and merge the
+/// runs with a SortedRunMerger at the end.
+constexpr int64_t kSortRunLength = OrderByNodeOptions::kDefaultSortRunLength;
+
+/// \brief Number of runs below which the input is sorted at once
+///
+/// Merging costs about as much as sorting a few runs again, so the first run is only
+/// cut once this many runs worth of rows have arrived, and smaller inputs are sorted
+/// at once at the end.
+constexpr int64_t kMinMergedRuns = 4;
+
+/// \brief Merges runs of rows that are each sorted into one sorted sequence
+///
+/// Rows are compared the way SortIndices compares them, including null placement
+/// and the placement of NaNs.  Rows that compare equal are taken from the run that
+/// was added first, so the merge is stable with respect to the order of the runs.
+class SortedRunMerger {
+ public:
+  /// \brief Returns the next batch of a run, or null once the run is exhausted
+  using RunReader = std::function<Result<std::shared_ptr<RecordBatch>>()>;
+
+  virtual ~SortedRunMerger() = default;
+
+  /// \brief Returns the next (at most `max_rows`) rows in order, or null at the end
+  virtual Result<std::shared_ptr<RecordBatch>> Next(int64_t max_rows) = 0;
+
+  /// \brief Create a merger
+  ///
+  /// Returns NotImplemented if a sort key is nested or has a type that the merger
+  /// cannot compare (e.g. dictionaries).
+  static Result<std::unique_ptr<SortedRunMerger>> Make(
+      ExecContext* ctx, std::shared_ptr<Schema> schema, const Ordering& ordering,
+      std::vector<RunReader> runs);
+
+  /// \brief Whether Make can merge runs of the given schema on the given ordering
+  static bool CanMerge(const Schema& schema, const Ordering& ordering);
+};
+
+/// \brief Number of rows a thread buffers before it selects its top-k candidates
+///
+/// The buffer also grows with the candidates, so that selecting from many groups
+/// stays amortized linear.
+constexpr int64_t kTopKBufferRows = 64 * 1024;
+
+/// \brief Selects the first k rows of a stream of batches in an ordering, per group
+///
+/// Each thread keeps its own candidates and buffers incoming rows until there are
+/// kTopKBufferRows of them, then selects the first k rows of every group (and the
+/// rows tied with the k-th one, if ties are kept) from the candidates and the
+/// buffer.  Without groups, rows that sort after a thread's k-th candidate are
+/// dropped before they are buffered.  Memory is thus O(k * threads) per group
+/// rather than O(rows).
+class TopKSelector {
+ public:
+  virtual ~TopKSelector() = default;
+
+  /// \brief Adds the rows of a batch, received on the thread with the given index
+  ///
+  /// Batches received on the same thread index must not be added concurrently.
+  virtual Status Consume(size_t thread_index,
+                         const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Selects from the candidates of all threads
+  ///
+  /// The rows are sorted by the ordering within each group, and the rows of each
+  /// group are contiguous.
+  virtual Result<std::shared_ptr<Table>> Finish() = 0;
+
+  /// \brief Create a selector
+  ///
+  /// Returns NotImplemented if a group key or a sort key is nested.
+  static Result<std::unique_ptr<TopKSelector>> Make(
+      ExecContext* ctx, std::shared_ptr<Schema> schema, Ordering ordering, int64_t k,
+      bool with_ties, std::vector<FieldRef> keys, size_t num_threads);
+};
+
 }  // namespace acero
 }  // namespace arrow
@@ -15,21 +15,27 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/exec_plan_internal.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/order_by_impl.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/tracing_internal.h"
 
@@ -45,10 +51,13 @@ namespace {
 class OrderByNode : public ExecNode, public TracedNode {
  public:
   OrderByNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, Ordering new_ordering)
+              std::shared_ptr<Schema> output_schema, Ordering new_ordering,
+              int64_t sort_run_length, int64_t spill_memory_limit)
       : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
         TracedNode(this),
-        ordering_(std::move(new_ordering)) {}
+        ordering_(std::move(new_ordering)),
+        sort_run_length_(sort_run_length),
+        spill_memory_limit_(spill_memory_limit) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -60,9 +69,22 @@ class OrderByNode : public ExecNode, public TracedNode {
       return Status::Invalid("`ordering` must be an explicit non-empty ordering");
     }
 
+    if (order_options.sort_run_length < 0) {
+      return Status::Invalid("`sort_run_length` must be non-negative, got ",
+                             order_options.sort_run_length);
+    }
+
     std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
+    // The input can only be sorted in runs if the runs can be merged back together
+    int64_t sort_run_length = order_options.sort_run_length;
+    int64_t spill_memory_limit = plan->query_context()->options().spill_memory_limit;
+    if (!SortedRunMerger::CanMerge(*output_schema, order_options.ordering)) {
+      sort_run_length = 0;
+      spill_memory_limit = 0;
+    }
     return plan->EmplaceNode<OrderByNode>(
-        plan, std::move(inputs), std::move(output_schema), order_options.ordering);
+        plan, std::move(inputs), std::move(output_schema), order_options.ordering,
+        sort_run_length, spill_memory_limit);
   }
 
   const char* kind_name() const override { return "OrderByNode"; }
@@ -86,25 +108,82 @@ class OrderByNode : public ExecNode, public TracedNode {
   }
 
   void PauseProducing(ExecNode* output, int32_t counter) override {
+    {
+      std::lock_guard lk(merge_mutex_);
+      if (counter > backpressure_counter_) {
+        backpressure_counter_ = counter;
+        merge_paused_ = true;
+      }
+    }
     inputs_[0]->PauseProducing(this, counter);
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
+    bool resume_merge = false;
+    {
+      std::lock_guard lk(merge_mutex_);
+      if (counter > backpressure_counter_) {
+        backpressure_counter_ = counter;
+        merge_paused_ = false;
+        resume_merge = merge_pending_;
+        merge_pending_ = false;
+      }
+    }
+    if (resume_merge) {
+      ScheduleMergedBatch(/*force=*/true);
+    }
     inputs_[0]->ResumeProducing(this, counter);
   }
 
-  Status StopProducingImpl() override { return Status::OK(); }
+  Status StopProducingImpl() override {
+    stopped_.store(true);
+    return Status::OK();
+  }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
     auto scope = TraceInputReceived(batch);
     DCHECK_EQ(input, inputs_[0]);
 
+    int64_t batch_size = batch.TotalBufferSize();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
                           batch.ToRecordBatch(output_schema_));
 
+    std::vector<std::shared_ptr<RecordBatch>> run;
+    std::vector<std::shared_ptr<Table>> runs_to_spill;
+    bool spill = false;
     {
       std::lock_guard lk(mutex_);
       accumulation_queue_.push_back(std::move(record_batch));
+      accumulated_rows_ += batch.length;
+      accumulated_bytes_ += batch_size;
+      if (spill_memory_limit_ > 0 && accumulated_bytes_ > spill_memory_limit_) {
+        // Everything that is held in memory goes to disk
+        run.swap(accumulation_queue_);
+        runs_to_spill.swap(sorted_runs_);
+        spill = true;
+        accumulated_rows_ = 0;
+        accumulated_bytes_ = 0;
+        ++num_runs_;
+      } else if (sort_run_length_ > 0 &&
+                 accumulated_rows_ >=
+                     (num_runs_ == 0 ? kMinMergedRuns : 1) * sort_run_length_) {
+        run.swap(accumulation_queue_);
+        accumulated_rows_ = 0;
+        ++num_runs_;
+      }
+    }
+    // Runs are sorted outside of the lock so that threads can sort runs in parallel
+    if (!run.empty()) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted, Sort(std::move(run)));
+      if (spill) {
+        runs_to_spill.push_back(std::move(sorted));
+        for (const auto& run_to_spill : runs_to_spill) {
+          RETURN_NOT_OK(SpillSortedRun(*run_to_spill));
+        }
+      } else {
+        std::lock_guard lk(mutex_);
+        sorted_runs_.push_back(std::move(sorted));
+      }
     }
 
     if (counter_.Increment()) {
@@ -113,17 +192,57 @@ class OrderByNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
-  Status DoFinish() {
-    ARROW_ASSIGN_OR_RAISE(
-        auto table,
-        Table::FromRecordBatches(output_schema_, std::move(accumulation_queue_)));
+  Result<std::shared_ptr<Table>> Sort(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
     SortOptions sort_options(ordering_.sort_keys(), ordering_.null_placement());
     ExecContext* ctx = plan_->query_context()->exec_context();
     ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, sort_options, ctx));
     ARROW_ASSIGN_OR_RAISE(Datum sorted,
                           Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
-    const std::shared_ptr<Table>& sorted_table = sorted.table();
-    TableBatchReader reader(*sorted_table);
+    return sorted.table();
+  }
+
+  // Writes a sorted run to a temporary file, to be merged with the other runs once the
+  // input has finished
+  Status SpillSortedRun(const Table& sorted) {
+    SpillFile* file;
+    {
+      std::lock_guard lk(spill_mutex_);
+      if (!spill_dir_) {
+        ARROW_ASSIGN_OR_RAISE(spill_dir_,
+                              arrow::internal::TemporaryDir::Make("arrow-acero-sort-"));
+      }
+      std::string path = spill_dir_->path().ToString() + "run-" +
+                         std::to_string(spilled_runs_.size()) + ".arrow";
+      spilled_runs_.push_back(std::make_unique<SpillFile>(
+          plan_->query_context(), std::move(path), output_schema_));
+      file = spilled_runs_.back().get();
+    }
+    TableBatchReader reader(sorted);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) {
+        break;
+      }
+      RETURN_NOT_OK(file->Append(ExecBatch(*next)));
+    }
+    return file->FinishWriting();
+  }
+
+  Status DoFinish() {
+    std::vector<std::shared_ptr<Table>> runs = std::move(sorted_runs_);
+    if (!accumulation_queue_.empty() || runs.empty()) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted,
+                            Sort(std::move(accumulation_queue_)));
+      runs.push_back(std::move(sorted));
+    }
+    if (!spilled_runs_.empty() || runs.size() > 1) {
+      return StartMerging(std::move(runs));
+    }
+
+    TableBatchReader reader(*runs[0]);
     reader.set_chunksize(ExecPlan::kMaxBatchSize);
     int batch_index = 0;
     while (true) {
@@ -142,6 +261,64 @@ class OrderByNode : public ExecNode, public TracedNode {
     }
   }
 
+  // Merges the spilled runs and the runs that are still in memory.  The merge is
+  // sequential, so merged batches are produced one task after the other, starting
+  // as soon as the runs are sorted.
+  Status StartMerging(std::vector<std::shared_ptr<Table>> runs) {
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    std::vector<SortedRunMerger::RunReader> readers;
+    for (const auto& run : spilled_runs_) {
+      readers.push_back(
+          [file = run.get(), this, ctx]() -> Result<std::shared_ptr<RecordBatch>> {
+            ARROW_ASSIGN_OR_RAISE(std::optional<ExecBatch> batch, file->ReadNext());
+            if (!batch) {
+              return nullptr;
+            }
+            return batch->ToRecordBatch(output_schema_, ctx->memory_pool());
+          });
+    }
+    for (auto& run : runs) {
+      auto reader = std::make_shared<TableBatchReader>(std::move(run));
+      reader->set_chunksize(ExecPlan::kMaxBatchSize);
+      readers.push_back([reader]() { return reader->Next(); });
+    }
+
+    ARROW_ASSIGN_OR_RAISE(merger_, SortedRunMerger::Make(ctx, output_schema_, ordering_,
+                                                         std::move(readers)));
+    ScheduleMergedBatch(/*force=*/false);
+    return Status::OK();
+  }
+
+  void ScheduleMergedBatch(bool force) {
+    if (!force) {
+      std::lock_guard lk(merge_mutex_);
+      if (merge_paused_) {
+        merge_pending_ = true;
+        return;
+      }
+    }
+    plan_->query_context()->ScheduleTask([this]() { return EmitMergedBatch(); },
+                                         "OrderByNode::MergeSortedRuns");
+  }
+
+  Status EmitMergedBatch() {
+    if (stopped_.load()) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch,
+                          merger_->Next(ExecPlan::kMaxBatchSize));
+    if (!batch) {
+      merger_.reset();
+      spilled_runs_.clear();
+      return output_->InputFinished(this, num_merged_batches_);
+    }
+    ExecBatch exec_batch(*batch);
+    exec_batch.index = num_merged_batches_++;
+    RETURN_NOT_OK(output_->InputReceived(this, std::move(exec_batch)));
+    ScheduleMergedBatch(/*force=*/false);
+    return Status::OK();
+  }
+
  protected:
   std::string ToStringExtra(int indent = 0) const override {
     std::stringstream ss;
@@ -154,6 +331,27 @@ class OrderByNode : public ExecNode, public TracedNode {
   Ordering ordering_;
   std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
   std::mutex mutex_;
+
+  // The input is sorted in runs of sort_run_length_ rows that are merged at the end,
+  // unless sort_run_length_ is zero.  The first run is kMinMergedRuns times longer.
+  int64_t sort_run_length_;
+  int64_t num_runs_ = 0;
+  int64_t accumulated_rows_ = 0;
+  std::vector<std::shared_ptr<Table>> sorted_runs_;
+
+  // External sort, see QueryOptions::spill_memory_limit
+  int64_t spill_memory_limit_;
+  int64_t accumulated_bytes_ = 0;
+  std::mutex spill_mutex_;
+  std::unique_ptr<arrow::internal::TemporaryDir> spill_dir_;
+  std::vector<std::unique_ptr<SpillFile>> spilled_runs_;
+  std::unique_ptr<SortedRunMerger> merger_;
+  int num_merged_batches_ = 0;
+  std::mutex merge_mutex_;
+  int32_t backpressure_counter_ = 0;
+  bool merge_paused_ = false;
+  bool merge_pending_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 }  // namespace
@@ -22,10 +22,12 @@
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
+#include "arrow/compute/util.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
@@ -83,6 +85,54 @@ class ProjectNode : public MapNode {
 
   const char* kind_name() const override { return "ProjectNode"; }
 
+  // A runtime filter moves past the projection if the fields it refers to are plain
+  // copies of input fields.  Parts of it that refer to computed fields are dropped.
+  Result<bool> PushRuntimeFilter(const RuntimeFilter& filter) override {
+    auto to_input = [this](const FieldRef& ref) -> const FieldRef* {
+      auto maybe_path = ref.FindOne(*output_schema_);
+      if (!maybe_path.ok() || maybe_path->indices().size() != 1) {
+        return nullptr;
+      }
+      return exprs_[(*maybe_path)[0]].field_ref();
+    };
+
+    RuntimeFilter pushed;
+    bool expression_pushed = true;
+    ARROW_ASSIGN_OR_RAISE(
+        pushed.expression,
+        compute::ModifyExpression(
+            filter.expression,
+            [&](Expression expr) {
+              if (const FieldRef* ref = expr.field_ref()) {
+                if (const FieldRef* input_ref = to_input(*ref)) {
+                  return compute::field_ref(*input_ref);
+                }
+                expression_pushed = false;
+              }
+              return expr;
+            },
+            [](Expression expr, ...) { return expr; }));
+    if (!expression_pushed) {
+      pushed.expression = compute::literal(true);
+    }
+    if (filter.bloom_filter) {
+      pushed.bloom_filter = filter.bloom_filter;
+      for (const FieldRef& key : filter.bloom_filter_keys) {
+        const FieldRef* input_ref = to_input(key);
+        if (!input_ref) {
+          pushed.bloom_filter.reset();
+          pushed.bloom_filter_keys.clear();
+          break;
+        }
+        pushed.bloom_filter_keys.push_back(*input_ref);
+      }
+    }
+    if (pushed.expression == compute::literal(true) && !pushed.bloom_filter) {
+      return false;
+    }
+    return inputs_[0]->PushRuntimeFilter(pushed);
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
     std::vector<Datum> values{exprs_.size()};
     for (size_t i = 0; i < exprs_.size(); ++i) {
@@ -0,0 +1,852 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+using compute::CastOptions;
+using compute::ExecSpan;
+using compute::Grouper;
+using compute::SortKey;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+// The type that both columns of a condition are cast to, in which their values
+// compare the way the condition compares them
+Result<std::shared_ptr<DataType>> ComparisonType(const DataType& left,
+                                                 const DataType& right) {
+  if (is_integer(left.id()) && is_integer(right.id())) {
+    if (left.id() == Type::UINT64 && right.id() == Type::UINT64) {
+      return uint64();
+    }
+    if (left.id() != Type::UINT64 && right.id() != Type::UINT64) {
+      return int64();
+    }
+    return float64();
+  }
+  if (is_numeric(left.id()) && is_numeric(right.id())) {
+    return float64();
+  }
+  if (is_temporal(left.id()) && left.Equals(right)) {
+    return int64();
+  }
+  if (is_base_binary_like(left.id()) && is_base_binary_like(right.id())) {
+    return large_binary();
+  }
+  return Status::TypeError("Cannot compare ", left, " to ", right,
+                           " in a range join condition");
+}
+
+Result<std::shared_ptr<Array>> ToComparisonType(const std::shared_ptr<Array>& array,
+                                                const std::shared_ptr<DataType>& type,
+                                                ExecContext* ctx) {
+  std::shared_ptr<Array> values = array;
+  if (is_temporal(array->type_id())) {
+    // Temporal values of the same type compare like their integers
+    std::shared_ptr<DataType> storage_type =
+        array->type()->byte_width() == 4 ? int32() : int64();
+    ARROW_ASSIGN_OR_RAISE(values, array->View(storage_type));
+  }
+  if (values->type()->Equals(*type)) {
+    return values;
+  }
+  // Integers beyond 2^53 compare approximately as doubles, like they do in R
+  ARROW_ASSIGN_OR_RAISE(Datum cast,
+                        compute::Cast(values, type, CastOptions::Unsafe(), ctx));
+  return cast.make_array();
+}
+
+// Whether a value of a condition column can satisfy the condition at all
+bool IsComparable(const Array& values, int64_t row) {
+  if (values.IsNull(row)) {
+    return false;
+  }
+  if (values.type_id() == Type::DOUBLE) {
+    return !std::isnan(checked_cast<const DoubleArray&>(values).Value(row));
+  }
+  return true;
+}
+
+// Compares the left values of a condition to its right values, which are sorted in
+// ascending order if the condition is the first one
+class ConditionComparator {
+ public:
+  virtual ~ConditionComparator() = default;
+
+  // Whether a left row and a right row satisfy the condition
+  virtual bool Matches(int64_t left_row, int64_t right_row) const = 0;
+
+  // Narrows the sorted right rows [*begin, *end) to the ones that satisfy the
+  // condition with the left row
+  virtual void Narrow(int64_t left_row, int64_t* begin, int64_t* end) const = 0;
+
+  static Result<std::unique_ptr<ConditionComparator>> Make(JoinRangeCmp cmp,
+                                                           const Array& left,
+                                                           const Array& right);
+};
+
+template <typename ArrowType>
+class TypedConditionComparator : public ConditionComparator {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  TypedConditionComparator(JoinRangeCmp cmp, const Array& left, const Array& right)
+      : cmp_(cmp),
+        left_(checked_cast<const ArrayType&>(left)),
+        right_(checked_cast<const ArrayType&>(right)) {}
+
+  bool Matches(int64_t left_row, int64_t right_row) const override {
+    auto left = left_.GetView(left_row);
+    auto right = right_.GetView(right_row);
+    switch (cmp_) {
+      case JoinRangeCmp::LT:
+        return left < right;
+      case JoinRangeCmp::LE:
+        return left <= right;
+      case JoinRangeCmp::GT:
+        return left > right;
+      case JoinRangeCmp::GE:
+        return left >= right;
+    }
+    return false;
+  }
+
+  void Narrow(int64_t left_row, int64_t* begin, int64_t* end) const override {
+    auto left = left_.GetView(left_row);
+    switch (cmp_) {
+      case JoinRangeCmp::LT:
+        *begin = Bound(left, *begin, *end, /*after_equal=*/true);
+        break;
+      case JoinRangeCmp::LE:
+        *begin = Bound(left, *begin, *end, /*after_equal=*/false);
+        break;
+      case JoinRangeCmp::GT:
+        *end = Bound(left, *begin, *end, /*after_equal=*/false);
+        break;
+      case JoinRangeCmp::GE:
+        *end = Bound(left, *begin, *end, /*after_equal=*/true);
+        break;
+    }
+  }
+
+ private:
+  // The first right row in [begin, end) that is greater than the value (or greater or
+  // equal, unless after_equal)
+  template <typename Value>
+  int64_t Bound(const Value& value, int64_t begin, int64_t end, bool after_equal) const {
+    while (begin < end) {
+      int64_t middle = begin + (end - begin) / 2;
+      auto right = right_.GetView(middle);
+      if (after_equal ? !(value < right) : right < value) {
+        begin = middle + 1;
+      } else {
+        end = middle;
+      }
+    }
+    return begin;
+  }
+
+  JoinRangeCmp cmp_;
+  const ArrayType& left_;
+  const ArrayType& right_;
+};
+
+Result<std::unique_ptr<ConditionComparator>> ConditionComparator::Make(
+    JoinRangeCmp cmp, const Array& left, const Array& right) {
+  switch (left.type_id()) {
+    case Type::INT64:
+      return std::make_unique<TypedConditionComparator<Int64Type>>(cmp, left, right);
+    case Type::UINT64:
+      return std::make_unique<TypedConditionComparator<UInt64Type>>(cmp, left, right);
+    case Type::DOUBLE:
+      return std::make_unique<TypedConditionComparator<DoubleType>>(cmp, left, right);
+    case Type::LARGE_BINARY:
+      return std::make_unique<TypedConditionComparator<LargeBinaryType>>(cmp, left,
+                                                                          right);
+    default:
+      break;
+  }
+  return Status::NotImplemented("Range join comparison of ", *left.type());
+}
+
+std::string CmpToString(JoinRangeCmp cmp) {
+  switch (cmp) {
+    case JoinRangeCmp::LT:
+      return "<";
+    case JoinRangeCmp::LE:
+      return "<=";
+    case JoinRangeCmp::GT:
+      return ">";
+    case JoinRangeCmp::GE:
+      return ">=";
+  }
+  return "?";
+}
+
+struct BoundCondition {
+  int left_id;
+  JoinRangeCmp cmp;
+  int right_id;
+  std::shared_ptr<DataType> type;
+};
+
+class RangeJoinNode : public ExecNode, public TracedNode {
+ public:
+  RangeJoinNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                std::shared_ptr<Schema> output_schema, JoinType join_type,
+                std::vector<int> left_key_ids, std::vector<int> right_key_ids,
+                std::vector<JoinKeyCmp> key_cmp, std::vector<BoundCondition> conditions,
+                std::vector<int> left_output_ids, std::vector<int> right_output_ids)
+      : ExecNode(plan, std::move(inputs), {"left", "right"}, std::move(output_schema)),
+        TracedNode(this),
+        join_type_(join_type),
+        left_key_ids_(std::move(left_key_ids)),
+        right_key_ids_(std::move(right_key_ids)),
+        key_cmp_(std::move(key_cmp)),
+        conditions_(std::move(conditions)),
+        left_output_ids_(std::move(left_output_ids)),
+        right_output_ids_(std::move(right_output_ids)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 2, "RangeJoinNode"));
+
+    const auto& join_options = checked_cast<const RangeJoinNodeOptions&>(options);
+    const Schema& left_schema = *inputs[0]->output_schema();
+    const Schema& right_schema = *inputs[1]->output_schema();
+
+    if (join_options.conditions.empty()) {
+      return Status::Invalid("A range join needs at least one condition");
+    }
+    if (join_options.left_keys.size() != join_options.right_keys.size()) {
+      return Status::Invalid("Different number of key fields on left (",
+                             join_options.left_keys.size(), ") and right (",
+                             join_options.right_keys.size(), ") side of the join");
+    }
+    std::vector<JoinKeyCmp> key_cmp = join_options.key_cmp;
+    if (key_cmp.empty()) {
+      key_cmp.resize(join_options.left_keys.size(), JoinKeyCmp::EQ);
+    } else if (key_cmp.size() != join_options.left_keys.size()) {
+      return Status::Invalid("Different number of key comparisons (", key_cmp.size(),
+                             ") and key fields (", join_options.left_keys.size(),
+                             ") in the join");
+    }
+
+    auto find = [](const FieldRef& ref, const Schema& schema) -> Result<int> {
+      ARROW_ASSIGN_OR_RAISE(FieldPath match, ref.FindOne(schema));
+      return match[0];
+    };
+
+    std::vector<int> left_key_ids, right_key_ids;
+    for (size_t i = 0; i < join_options.left_keys.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(int left_id, find(join_options.left_keys[i], left_schema));
+      ARROW_ASSIGN_OR_RAISE(int right_id,
+                            find(join_options.right_keys[i], right_schema));
+      const auto& left_type = left_schema.field(left_id)->type();
+      const auto& right_type = right_schema.field(right_id)->type();
+      if (!left_type->Equals(*right_type)) {
+        return Status::TypeError("Key field ", left_schema.field(left_id)->name(),
+                                 " of type ", *left_type, " on the left and ",
+                                 right_schema.field(right_id)->name(), " of type ",
+                                 *right_type, " on the right must have the same type");
+      }
+      left_key_ids.push_back(left_id);
+      right_key_ids.push_back(right_id);
+    }
+
+    std::vector<BoundCondition> conditions;
+    for (const JoinRangeCondition& condition : join_options.conditions) {
+      ARROW_ASSIGN_OR_RAISE(int left_id, find(condition.left, left_schema));
+      ARROW_ASSIGN_OR_RAISE(int right_id, find(condition.right, right_schema));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<DataType> type,
+                            ComparisonType(*left_schema.field(left_id)->type(),
+                                           *right_schema.field(right_id)->type()));
+      conditions.push_back({left_id, condition.cmp, right_id, std::move(type)});
+    }
+
+    JoinType join_type = join_options.join_type;
+    bool output_left =
+        join_type != JoinType::RIGHT_SEMI && join_type != JoinType::RIGHT_ANTI;
+    bool output_right =
+        join_type != JoinType::LEFT_SEMI && join_type != JoinType::LEFT_ANTI;
+    std::vector<int> left_output_ids, right_output_ids;
+    std::unordered_set<std::string> left_names, right_names;
+    if (output_left) {
+      for (const FieldRef& ref : join_options.left_output) {
+        ARROW_ASSIGN_OR_RAISE(int id, find(ref, left_schema));
+        left_output_ids.push_back(id);
+        left_names.insert(left_schema.field(id)->name());
+      }
+    }
+    if (output_right) {
+      for (const FieldRef& ref : join_options.right_output) {
+        ARROW_ASSIGN_OR_RAISE(int id, find(ref, right_schema));
+        right_output_ids.push_back(id);
+        right_names.insert(right_schema.field(id)->name());
+      }
+    }
+    // Fields of the same name on both sides get the suffixes, as in a hash join
+    FieldVector fields;
+    for (int id : left_output_ids) {
+      const auto& input_field = left_schema.field(id);
+      std::string name = input_field->name();
+      if (right_names.count(name) > 0) {
+        name += join_options.output_suffix_for_left;
+      }
+      fields.push_back(field(std::move(name), input_field->type()));
+    }
+    for (int id : right_output_ids) {
+      const auto& input_field = right_schema.field(id);
+      std::string name = input_field->name();
+      if (left_names.count(name) > 0) {
+        name += join_options.output_suffix_for_right;
+      }
+      fields.push_back(field(std::move(name), input_field->type()));
+    }
+
+    return plan->EmplaceNode<RangeJoinNode>(
+        plan, std::move(inputs), schema(std::move(fields)), join_type,
+        std::move(left_key_ids), std::move(right_key_ids), std::move(key_cmp),
+        std::move(conditions), std::move(left_output_ids), std::move(right_output_ids));
+  }
+
+  const char* kind_name() const override { return "RangeJoinNode"; }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (input == inputs_[1]) {
+      if (right_counter_.SetTotal(total_batches)) {
+        return BuildRight();
+      }
+      return Status::OK();
+    }
+    DCHECK_EQ(input, inputs_[0]);
+    // The probe of each left batch and the build of the right side must be done
+    if (probe_counter_.SetTotal(total_batches + 1)) {
+      return Finish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    if (input == inputs_[1]) {
+      {
+        std::lock_guard lk(mutex_);
+        right_batches_.push_back(std::move(batch));
+      }
+      if (right_counter_.Increment()) {
+        return BuildRight();
+      }
+      return Status::OK();
+    }
+    DCHECK_EQ(input, inputs_[0]);
+    {
+      // Left batches wait until all of the right side is there
+      std::lock_guard lk(mutex_);
+      if (!built_) {
+        pending_left_batches_.push_back(std::move(batch));
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(Probe(batch));
+    return ProbeDone();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    const Schema& left_schema = *inputs_[0]->output_schema();
+    const Schema& right_schema = *inputs_[1]->output_schema();
+    std::stringstream ss;
+    ss << "type=" << acero::ToString(join_type_) << ", conditions=[";
+    for (size_t i = 0; i < conditions_.size(); ++i) {
+      const BoundCondition& condition = conditions_[i];
+      ss << (i > 0 ? ", " : "") << left_schema.field(condition.left_id)->name() << ' '
+         << CmpToString(condition.cmp) << ' '
+         << right_schema.field(condition.right_id)->name();
+    }
+    ss << ']';
+    if (!left_key_ids_.empty()) {
+      ss << ", keys=[";
+      for (size_t i = 0; i < left_key_ids_.size(); ++i) {
+        ss << (i > 0 ? ", " : "") << left_schema.field(left_key_ids_[i])->name()
+           << (key_cmp_[i] == JoinKeyCmp::EQ ? " = " : " is ")
+           << right_schema.field(right_key_ids_[i])->name();
+      }
+      ss << ']';
+    }
+    return ss.str();
+  }
+
+ private:
+  ExecContext* exec_context() const { return plan_->query_context()->exec_context(); }
+
+  bool EmitsPairs() const {
+    return join_type_ == JoinType::INNER || join_type_ == JoinType::LEFT_OUTER ||
+           join_type_ == JoinType::RIGHT_OUTER || join_type_ == JoinType::FULL_OUTER;
+  }
+
+  bool MarksRight() const {
+    return join_type_ == JoinType::RIGHT_SEMI || join_type_ == JoinType::RIGHT_ANTI ||
+           join_type_ == JoinType::RIGHT_OUTER || join_type_ == JoinType::FULL_OUTER;
+  }
+
+  ExecBatch KeyBatch(const RecordBatch& batch, const std::vector<int>& key_ids) const {
+    std::vector<Datum> keys;
+    for (int id : key_ids) {
+      keys.emplace_back(batch.column(id));
+    }
+    return ExecBatch(std::move(keys), batch.num_rows());
+  }
+
+  // Whether a row of an input can match any row of the other input
+  bool CanMatch(const RecordBatch& batch, const std::vector<int>& key_ids,
+                const std::vector<std::shared_ptr<Array>>& values, int64_t row) const {
+    for (size_t i = 0; i < key_ids.size(); ++i) {
+      if (key_cmp_[i] == JoinKeyCmp::EQ && batch.column(key_ids[i])->IsNull(row)) {
+        return false;
+      }
+    }
+    for (const auto& column : values) {
+      if (!IsComparable(*column, row)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Sorts the right rows that can match by key and by the right column of the first
+  // condition, and puts the others at the end
+  Status BuildRight() {
+    ExecContext* ctx = exec_context();
+    std::vector<ExecBatch> batches;
+    {
+      std::lock_guard lk(mutex_);
+      batches = std::move(right_batches_);
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Table> table,
+        TableFromExecBatches(inputs_[1]->output_schema(), std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> right,
+                          table->CombineChunksToBatch(ctx->memory_pool()));
+    int64_t num_rows = right->num_rows();
+
+    std::vector<std::shared_ptr<Array>> values;
+    for (const BoundCondition& condition : conditions_) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> column,
+          ToComparisonType(right->column(condition.right_id), condition.type, ctx));
+      values.push_back(std::move(column));
+    }
+
+    std::vector<uint32_t> group_ids(num_rows, 0);
+    uint32_t num_groups = 1;
+    if (!right_key_ids_.empty()) {
+      ExecBatch keys = KeyBatch(*right, right_key_ids_);
+      ARROW_ASSIGN_OR_RAISE(grouper_, Grouper::Make(keys.GetTypes(), ctx));
+      ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Consume(ExecSpan(keys)));
+      const auto& id_array = checked_cast<const UInt32Array&>(*ids.make_array());
+      std::copy(id_array.raw_values(), id_array.raw_values() + num_rows,
+                group_ids.begin());
+      num_groups = grouper_->num_groups();
+    }
+
+    std::vector<int64_t> rows, other_rows;
+    UInt32Builder row_group_ids(ctx->memory_pool());
+    for (int64_t row = 0; row < num_rows; ++row) {
+      if (CanMatch(*right, right_key_ids_, values, row)) {
+        rows.push_back(row);
+        RETURN_NOT_OK(row_group_ids.Append(group_ids[row]));
+      } else {
+        other_rows.push_back(row);
+      }
+    }
+    int64_t num_matchable = static_cast<int64_t>(rows.size());
+
+    if (num_matchable > 0) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> matchable_group_ids,
+                            row_group_ids.Finish());
+      ARROW_ASSIGN_OR_RAISE(Datum first_values,
+                            compute::Take(values[0], ToInt64Array(rows),
+                                          TakeOptions::NoBoundsCheck(), ctx));
+      auto sort_batch = RecordBatch::Make(
+          schema({field("group_id", uint32()), field("value", conditions_[0].type)}),
+          num_matchable, {matchable_group_ids, first_values.make_array()});
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> sorted,
+          compute::SortIndices(Datum(sort_batch),
+                               compute::SortOptions({SortKey(0), SortKey(1)}), ctx));
+      const auto& sorted_indices = checked_cast<const UInt64Array&>(*sorted);
+      std::vector<int64_t> sorted_rows(num_matchable);
+      for (int64_t i = 0; i < num_matchable; ++i) {
+        sorted_rows[i] = rows[sorted_indices.Value(i)];
+      }
+      rows = std::move(sorted_rows);
+    }
+
+    group_offsets_.assign(num_groups + 1, 0);
+    for (int64_t row : rows) {
+      ++group_offsets_[group_ids[row] + 1];
+    }
+    for (uint32_t group = 0; group < num_groups; ++group) {
+      group_offsets_[group + 1] += group_offsets_[group];
+    }
+
+    rows.insert(rows.end(), other_rows.begin(), other_rows.end());
+    std::shared_ptr<Array> order = ToInt64Array(rows);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum sorted_right,
+        compute::Take(right, order, TakeOptions::NoBoundsCheck(), ctx));
+    right_ = sorted_right.record_batch();
+    for (const auto& column : values) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum sorted_values,
+          compute::Take(column, order, TakeOptions::NoBoundsCheck(), ctx));
+      right_values_.push_back(sorted_values.make_array());
+    }
+    RETURN_NOT_OK(PrepareScanBound(num_groups));
+    if (MarksRight()) {
+      right_matched_.reset(new std::atomic<bool>[num_rows]());
+    }
+
+    std::vector<ExecBatch> pending;
+    {
+      std::lock_guard lk(mutex_);
+      built_ = true;
+      pending = std::move(pending_left_batches_);
+    }
+    for (ExecBatch& batch : pending) {
+      plan_->query_context()->ScheduleTask(
+          [this, batch = std::move(batch)]() {
+            RETURN_NOT_OK(Probe(batch));
+            return ProbeDone();
+          },
+          "RangeJoinNode::ProbeBatch");
+    }
+    return ProbeDone();
+  }
+
+  // Whether the first condition keeps the first of the sorted right rows of a group,
+  // rather than the last
+  bool ScansBackward() const {
+    JoinRangeCmp cmp = conditions_[0].cmp;
+    return cmp == JoinRangeCmp::GT || cmp == JoinRangeCmp::GE;
+  }
+
+  // Intervals are joined with a second condition that bounds the right rows from the
+  // other side, e.g. `ts >= start` and `ts < end`.  The rows that satisfy the first
+  // condition are then scanned from its bound, along with the greatest `end` so far,
+  // and the scan stops as soon as no row left to scan can satisfy the second one.
+  Status PrepareScanBound(uint32_t num_groups) {
+    bool backward = ScansBackward();
+    for (size_t i = 1; i < conditions_.size() && scan_condition_ < 0; ++i) {
+      JoinRangeCmp cmp = conditions_[i].cmp;
+      bool needs_greatest = cmp == JoinRangeCmp::LT || cmp == JoinRangeCmp::LE;
+      if (needs_greatest == backward) {
+        scan_condition_ = static_cast<int>(i);
+      }
+    }
+    if (scan_condition_ < 0) {
+      return Status::OK();
+    }
+    const Array& values = *right_values_[scan_condition_];
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<ConditionComparator> less,
+                          ConditionComparator::Make(JoinRangeCmp::LT, values, values));
+    // The row with the greatest value from the start of the group to each row when
+    // scanning backward, or the row with the least value from each row to the end of
+    // the group when scanning forward
+    scan_bounds_.resize(group_offsets_[num_groups]);
+    for (uint32_t group = 0; group < num_groups; ++group) {
+      int64_t begin = group_offsets_[group];
+      int64_t end = group_offsets_[group + 1];
+      if (backward) {
+        for (int64_t row = begin; row < end; ++row) {
+          bool greatest = row == begin || less->Matches(scan_bounds_[row - 1], row);
+          scan_bounds_[row] = greatest ? row : scan_bounds_[row - 1];
+        }
+      } else {
+        for (int64_t row = end - 1; row >= begin; --row) {
+          bool least = row == end - 1 || less->Matches(row, scan_bounds_[row + 1]);
+          scan_bounds_[row] = least ? row : scan_bounds_[row + 1];
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  static std::shared_ptr<Array> ToInt64Array(const std::vector<int64_t>& values) {
+    return std::make_shared<Int64Array>(static_cast<int64_t>(values.size()),
+                                        Buffer::FromVector(values));
+  }
+
+  // Matches the rows of a left batch with the right rows
+  Status Probe(const ExecBatch& batch) {
+    ExecContext* ctx = exec_context();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> left,
+                          batch.ToRecordBatch(inputs_[0]->output_schema()));
+    int64_t num_rows = left->num_rows();
+
+    std::vector<std::shared_ptr<Array>> values;
+    std::vector<std::unique_ptr<ConditionComparator>> comparators;
+    for (size_t i = 0; i < conditions_.size(); ++i) {
+      const BoundCondition& condition = conditions_[i];
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> column,
+          ToComparisonType(left->column(condition.left_id), condition.type, ctx));
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ConditionComparator> comparator,
+          ConditionComparator::Make(condition.cmp, *column, *right_values_[i]));
+      values.push_back(std::move(column));
+      comparators.push_back(std::move(comparator));
+    }
+
+    std::shared_ptr<UInt32Array> group_ids;
+    if (grouper_) {
+      ExecBatch keys = KeyBatch(*left, left_key_ids_);
+      Datum ids;
+      {
+        // Lookups use the encoders of the grouper
+        std::lock_guard lk(mutex_);
+        ARROW_ASSIGN_OR_RAISE(ids, grouper_->Lookup(ExecSpan(keys)));
+      }
+      group_ids = checked_pointer_cast<UInt32Array>(ids.make_array());
+    }
+
+    bool emits_pairs = EmitsPairs();
+    bool marks_right = MarksRight();
+    bool emits_unmatched = join_type_ == JoinType::LEFT_ANTI ||
+                           join_type_ == JoinType::LEFT_OUTER ||
+                           join_type_ == JoinType::FULL_OUTER;
+    bool backward = ScansBackward();
+    OutputBuilder output(this, left.get());
+    for (int64_t row = 0; row < num_rows; ++row) {
+      bool matched = false;
+      if ((!group_ids || group_ids->IsValid(row)) &&
+          CanMatch(*left, left_key_ids_, values, row)) {
+        uint32_t group = group_ids ? group_ids->Value(row) : 0;
+        int64_t begin = group_offsets_[group];
+        int64_t end = group_offsets_[group + 1];
+        comparators[0]->Narrow(row, &begin, &end);
+        for (int64_t scanned = 0; scanned < end - begin; ++scanned) {
+          int64_t right_row = backward ? end - 1 - scanned : begin + scanned;
+          if (scan_condition_ >= 0 &&
+              !comparators[scan_condition_]->Matches(row, scan_bounds_[right_row])) {
+            break;
+          }
+          bool matches = true;
+          for (size_t i = 1; matches && i < comparators.size(); ++i) {
+            matches = comparators[i]->Matches(row, right_row);
+          }
+          if (!matches) {
+            continue;
+          }
+          matched = true;
+          if (marks_right) {
+            right_matched_[right_row].store(true, std::memory_order_relaxed);
+          }
+          if (emits_pairs) {
+            RETURN_NOT_OK(output.Append(row, right_row));
+          } else if (!marks_right) {
+            // A semi or anti join only needs to know whether there is a match
+            break;
+          }
+        }
+      }
+      if (matched ? join_type_ == JoinType::LEFT_SEMI : emits_unmatched) {
+        RETURN_NOT_OK(output.Append(row, kNoRow));
+      }
+    }
+    return output.Flush();
+  }
+
+  Status ProbeDone() {
+    if (probe_counter_.Increment()) {
+      return Finish();
+    }
+    return Status::OK();
+  }
+
+  // Emits the right rows that an outer, semi or anti join outputs after the probe
+  Status Finish() {
+    if (MarksRight()) {
+      bool emit_matched = join_type_ == JoinType::RIGHT_SEMI;
+      OutputBuilder output(this, nullptr);
+      for (int64_t row = 0; row < right_->num_rows(); ++row) {
+        if (right_matched_[row].load(std::memory_order_relaxed) == emit_matched) {
+          RETURN_NOT_OK(output.Append(kNoRow, row));
+        }
+      }
+      RETURN_NOT_OK(output.Flush());
+    }
+    return output_->InputFinished(this, num_output_batches_.load());
+  }
+
+  static constexpr int64_t kNoRow = -1;
+
+  // Collects the pairs of matching rows and emits them in batches
+  class OutputBuilder {
+   public:
+    OutputBuilder(RangeJoinNode* node, const RecordBatch* left)
+        : node_(node),
+          left_(left),
+          left_rows_(node->exec_context()->memory_pool()),
+          right_rows_(node->exec_context()->memory_pool()) {}
+
+    Status Append(int64_t left_row, int64_t right_row) {
+      RETURN_NOT_OK(AppendRow(&left_rows_, left_row));
+      RETURN_NOT_OK(AppendRow(&right_rows_, right_row));
+      if (left_rows_.length() == ExecPlan::kMaxBatchSize) {
+        return Flush();
+      }
+      return Status::OK();
+    }
+
+    Status Flush() {
+      int64_t num_rows = left_rows_.length();
+      if (num_rows == 0) {
+        return Status::OK();
+      }
+      ExecContext* ctx = node_->exec_context();
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> left_rows, left_rows_.Finish());
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> right_rows, right_rows_.Finish());
+      std::vector<Datum> columns;
+      for (int id : node_->left_output_ids_) {
+        if (left_ == nullptr) {
+          ARROW_ASSIGN_OR_RAISE(
+              std::shared_ptr<Array> nulls,
+              MakeArrayOfNull(left_schema().field(id)->type(), num_rows,
+                              ctx->memory_pool()));
+          columns.emplace_back(std::move(nulls));
+          continue;
+        }
+        ARROW_ASSIGN_OR_RAISE(Datum column,
+                              compute::Take(left_->column(id), left_rows,
+                                            TakeOptions::NoBoundsCheck(), ctx));
+        columns.push_back(std::move(column));
+      }
+      for (int id : node_->right_output_ids_) {
+        ARROW_ASSIGN_OR_RAISE(Datum column,
+                              compute::Take(node_->right_->column(id), right_rows,
+                                            TakeOptions::NoBoundsCheck(), ctx));
+        columns.push_back(std::move(column));
+      }
+      ExecBatch batch(std::move(columns), num_rows);
+      node_->num_output_batches_.fetch_add(1);
+      return node_->output_->InputReceived(node_, std::move(batch));
+    }
+
+   private:
+    const Schema& left_schema() const { return *node_->inputs_[0]->output_schema(); }
+
+    static Status AppendRow(Int64Builder* builder, int64_t row) {
+      return row == kNoRow ? builder->AppendNull() : builder->Append(row);
+    }
+
+    RangeJoinNode* node_;
+    const RecordBatch* left_;
+    Int64Builder left_rows_;
+    Int64Builder right_rows_;
+  };
+
+  JoinType join_type_;
+  std::vector<int> left_key_ids_;
+  std::vector<int> right_key_ids_;
+  std::vector<JoinKeyCmp> key_cmp_;
+  std::vector<BoundCondition> conditions_;
+  std::vector<int> left_output_ids_;
+  std::vector<int> right_output_ids_;
+
+  AtomicCounter right_counter_;
+  AtomicCounter probe_counter_;
+  std::atomic<int> num_output_batches_{0};
+  std::mutex mutex_;
+  std::vector<ExecBatch> right_batches_;
+  std::vector<ExecBatch> pending_left_batches_;
+  bool built_ = false;
+
+  // The right rows that can match, by group and first condition, then the others
+  std::shared_ptr<RecordBatch> right_;
+  // The condition columns of right_, cast to the comparison types
+  std::vector<std::shared_ptr<Array>> right_values_;
+  // The range of right_ rows of each group
+  std::vector<int64_t> group_offsets_;
+  // The condition that bounds the scan of the rows that satisfy the first one, if any
+  int scan_condition_ = -1;
+  std::vector<int64_t> scan_bounds_;
+  std::unique_ptr<Grouper> grouper_;
+  std::unique_ptr<std::atomic<bool>[]> right_matched_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterRangeJoinNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(RangeJoinNodeOptions::kName),
+                                 RangeJoinNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,187 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/runtime_filter.h"
+
+#include <utility>
+
+#include "arrow/acero/bloom_filter.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+
+namespace arrow {
+
+using compute::Expression;
+using compute::Hashing32;
+using compute::KeyColumnArray;
+
+namespace acero {
+
+RuntimeFilterSet::RuntimeFilterSet(std::shared_ptr<Schema> schema)
+    : schema_(std::move(schema)) {}
+
+RuntimeFilterSet::~RuntimeFilterSet() = default;
+
+Status RuntimeFilterSet::Add(const RuntimeFilter& filter) {
+  ARROW_ASSIGN_OR_RAISE(Expression bound_expression, filter.expression.Bind(*schema_));
+  if (bound_expression.type()->id() != Type::BOOL) {
+    return Status::TypeError("A runtime filter must evaluate to bool, but ",
+                             filter.expression.ToString(), " evaluates to ",
+                             bound_expression.type()->ToString());
+  }
+  BoundBloomFilter bloom_filter;
+  if (filter.bloom_filter) {
+    bloom_filter.filter = filter.bloom_filter;
+    for (const FieldRef& key : filter.bloom_filter_keys) {
+      ARROW_ASSIGN_OR_RAISE(FieldPath path, key.FindOne(*schema_));
+      if (path.indices().size() != 1) {
+        return Status::NotImplemented("Bloom filters on nested fields");
+      }
+      bloom_filter.key_ids.push_back(path[0]);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (filter.expression != compute::literal(true)) {
+    expression_ = compute::and_(std::move(expression_), filter.expression);
+    if (bound_expression_.is_valid()) {
+      ARROW_ASSIGN_OR_RAISE(
+          bound_expression_,
+          compute::and_(std::move(bound_expression_), std::move(bound_expression))
+              .Bind(*schema_));
+    } else {
+      bound_expression_ = std::move(bound_expression);
+    }
+  }
+  if (bloom_filter.filter) {
+    bloom_filters_.push_back(std::move(bloom_filter));
+  }
+  return Status::OK();
+}
+
+Expression RuntimeFilterSet::expression() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return expression_;
+}
+
+bool RuntimeFilterSet::empty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return !bound_expression_.is_valid() && bloom_filters_.empty();
+}
+
+int64_t RuntimeFilterSet::rows_filtered() const { return rows_filtered_.load(); }
+
+Result<ExecBatch> RuntimeFilterSet::Apply(ExecBatch batch, QueryContext* ctx) const {
+  Expression expression;
+  std::vector<BoundBloomFilter> bloom_filters;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    expression = bound_expression_;
+    bloom_filters = bloom_filters_;
+  }
+  if (batch.length == 0 || (!expression.is_valid() && bloom_filters.empty())) {
+    return batch;
+  }
+
+  // Rows that are null in the mask count as filtered out, as in a filter node
+  int64_t num_bytes = bit_util::BytesForBits(batch.length);
+  std::vector<uint8_t> selected(num_bytes, 0xff);
+  if (expression.is_valid()) {
+    ARROW_ASSIGN_OR_RAISE(expression,
+                          compute::SimplifyWithGuarantee(expression, batch.guarantee));
+    ARROW_ASSIGN_OR_RAISE(Datum mask, compute::ExecuteScalarExpression(
+                                          expression, batch, ctx->exec_context()));
+    if (mask.is_scalar()) {
+      const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+      if (!mask_scalar.is_valid || !mask_scalar.value) {
+        rows_filtered_.fetch_add(batch.length);
+        return batch.Slice(0, 0);
+      }
+    } else {
+      const ArrayData& mask_data = *mask.array();
+      arrow::internal::CopyBitmap(mask_data.buffers[1]->data(), mask_data.offset,
+                                  batch.length, selected.data(), 0);
+      if (mask_data.MayHaveNulls()) {
+        arrow::internal::BitmapAnd(selected.data(), 0, mask_data.buffers[0]->data(),
+                                   mask_data.offset, batch.length, 0, selected.data());
+      }
+    }
+  }
+  RETURN_NOT_OK(ApplyBloomFilters(batch, bloom_filters, ctx, selected.data()));
+
+  int64_t num_selected = arrow::internal::CountSetBits(selected.data(), 0, batch.length);
+  if (num_selected == batch.length) {
+    return batch;
+  }
+  rows_filtered_.fetch_add(batch.length - num_selected);
+  Datum selection(
+      ArrayData::Make(boolean(), batch.length,
+                      {nullptr, std::make_shared<Buffer>(selected.data(), num_bytes)},
+                      /*null_count=*/0));
+  for (Datum& value : batch.values) {
+    if (value.is_scalar()) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(value, compute::Filter(value, selection,
+                                                 compute::FilterOptions::Defaults(),
+                                                 ctx->exec_context()));
+  }
+  batch.length = num_selected;
+  return batch;
+}
+
+Status RuntimeFilterSet::ApplyBloomFilters(
+    const ExecBatch& batch, const std::vector<BoundBloomFilter>& bloom_filters,
+    QueryContext* ctx, uint8_t* selected) const {
+  if (bloom_filters.empty()) {
+    return Status::OK();
+  }
+  int64_t hardware_flags = ctx->cpu_info()->hardware_flags();
+  arrow::util::TempVectorStack stack;
+  RETURN_NOT_OK(stack.Init(ctx->memory_pool(), Hashing32::kHashBatchTempStackUsage));
+  std::vector<uint32_t> hashes(batch.length);
+  std::vector<uint8_t> found(bit_util::BytesForBits(batch.length));
+  std::vector<KeyColumnArray> temp_column_arrays;
+  for (const BoundBloomFilter& bloom_filter : bloom_filters) {
+    std::vector<Datum> keys(bloom_filter.key_ids.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      keys[i] = batch[bloom_filter.key_ids[i]];
+      if (keys[i].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(keys[i], MakeArrayFromScalar(*keys[i].scalar(),
+                                                           batch.length,
+                                                           ctx->memory_pool()));
+      }
+    }
+    ExecBatch key_batch(std::move(keys), batch.length);
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
+                                       hardware_flags, &stack, 0, batch.length));
+    bloom_filter.filter->Find(hardware_flags, batch.length, hashes.data(),
+                              found.data());
+    arrow::internal::BitmapAnd(found.data(), 0, selected, 0, batch.length, 0, selected);
+  }
+  return Status::OK();
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+using compute::ExecBatch;
+
+class BlockedBloomFilter;
+
+/// \brief A filter on the rows of a node's output that is only known once a plan runs
+///
+/// A hash join publishes these for its probe input once it has seen its whole build
+/// side.  Rows that do not pass the filter cannot find a match, so the node that
+/// produces them may drop them, or skip reading them at all.
+struct ARROW_ACERO_EXPORT RuntimeFilter {
+  /// \brief An unbound predicate, e.g. a key range or a short IN list
+  ///
+  /// Rows for which it is not true may be dropped.  Sources may also use it to skip
+  /// files or row groups whose statistics rule it out.
+  compute::Expression expression = compute::literal(true);
+  /// \brief An optional Bloom filter over the Hashing32 hashes of bloom_filter_keys
+  std::shared_ptr<BlockedBloomFilter> bloom_filter;
+  std::vector<FieldRef> bloom_filter_keys;
+};
+
+/// \brief The runtime filters that have been pushed into one source
+///
+/// Filters may be added while the source is producing, so all methods are thread safe.
+class ARROW_ACERO_EXPORT RuntimeFilterSet {
+ public:
+  /// \param schema the output schema of the source the filters apply to
+  explicit RuntimeFilterSet(std::shared_ptr<Schema> schema);
+  ~RuntimeFilterSet();
+
+  /// \brief Add a filter, failing if it does not refer to fields of the schema
+  Status Add(const RuntimeFilter& filter);
+
+  /// \brief The conjunction of the expressions added so far, unbound
+  compute::Expression expression() const;
+
+  /// \brief True if no filter has been added yet
+  bool empty() const;
+
+  /// \brief Drop the rows of a batch that one of the filters rules out
+  Result<ExecBatch> Apply(ExecBatch batch, QueryContext* ctx) const;
+
+  /// \brief The number of rows Apply has dropped so far
+  int64_t rows_filtered() const;
+
+ private:
+  struct BoundBloomFilter {
+    std::shared_ptr<BlockedBloomFilter> filter;
+    std::vector<int> key_ids;
+  };
+
+  Status ApplyBloomFilters(const ExecBatch& batch,
+                           const std::vector<BoundBloomFilter>& bloom_filters,
+                           QueryContext* ctx, uint8_t* selected) const;
+
+  std::shared_ptr<Schema> schema_;
+  mutable std::mutex mutex_;
+  compute::Expression expression_ = compute::literal(true);
+  compute::Expression bound_expression_;
+  std::vector<BoundBloomFilter> bloom_filters_;
+  mutable std::atomic<int64_t> rows_filtered_{0};
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
@@ -213,6 +214,7 @@ Status ScalarAggregateNode::DoConsume(const ExecSpan& batch, size_t thread_index
     KernelContext batch_ctx{plan()->query_context()->exec_context()};
     DCHECK_LT(thread_index, states_[i].size());
     batch_ctx.SetState(states_[i][thread_index].get());
+    thread_consumed_[thread_index] = true;
 
     std::vector<ExecValue> column_values;
     for (const int field : target_fieldsets_[i]) {
@@ -284,10 +286,78 @@ Status ScalarAggregateNode::ResetKernelStates() {
         KernelInitArgs{kernels_[i], kernel_intypes_[i], aggs_[i].options.get()},
         &states_[i]));
   }
+  std::fill(thread_consumed_.begin(), thread_consumed_.end(), false);
   return Status::OK();
 }
 
 Status ScalarAggregateNode::OutputResult(bool is_last) {
+  if (is_last && segment_field_ids_.empty()) {
+    // Only the states of the threads that consumed input need merging
+    merge_threads_.clear();
+    for (size_t thread_index = 0; thread_index < thread_consumed_.size();
+         ++thread_index) {
+      if (thread_consumed_[thread_index]) {
+        merge_threads_.push_back(thread_index);
+      }
+    }
+    if (merge_threads_.empty()) {
+      merge_threads_.push_back(0);
+    }
+    return MergeLevel(/*stride=*/1);
+  }
+
+  // Segments are output as the input is received (on a single thread, see Make)
+  for (size_t i = 0; i < kernels_.size(); ++i) {
+    KernelContext ctx{plan()->query_context()->exec_context()};
+    ARROW_ASSIGN_OR_RAISE(auto merged, ScalarAggregateKernel::MergeAll(
+                                           kernels_[i], &ctx, std::move(states_[i])));
+    states_[i].clear();
+    states_[i].push_back(std::move(merged));
+  }
+  merge_threads_ = {0};
+  return FinalizeAndOutput(is_last);
+}
+
+Status ScalarAggregateNode::MergeLevel(size_t stride) {
+  const size_t num_states = merge_threads_.size();
+  if (stride >= num_states) {
+    return FinalizeAndOutput(/*is_last=*/true);
+  }
+  int num_merges = 0;
+  for (size_t j = 0; j + stride < num_states; j += 2 * stride) {
+    ++num_merges;
+  }
+  pending_merges_.store(num_merges);
+  for (size_t j = 0; j + stride < num_states; j += 2 * stride) {
+    plan_->query_context()->ScheduleTask(
+        [this, j, stride]() -> Status {
+          const size_t to = merge_threads_[j];
+          const size_t from = merge_threads_[j + stride];
+          for (size_t i = 0; i < kernels_.size(); ++i) {
+            arrow::util::tracing::Span span;
+            START_COMPUTE_SPAN(
+                span, aggs_[i].function,
+                {{"function.name", aggs_[i].function},
+                 {"function.options",
+                  aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
+                 {"function.kind", std::string(kind_name()) + "::Merge"}});
+            KernelContext ctx{plan()->query_context()->exec_context()};
+            ctx.SetState(states_[i][to].get());
+            RETURN_NOT_OK(kernels_[i]->merge(&ctx, std::move(*states_[i][from]),
+                                             states_[i][to].get()));
+            states_[i][from].reset();
+          }
+          if (--pending_merges_ == 0) {
+            return MergeLevel(2 * stride);
+          }
+          return Status::OK();
+        },
+        "ScalarAggregateNode::Merge");
+  }
+  return Status::OK();
+}
+
+Status ScalarAggregateNode::FinalizeAndOutput(bool is_last) {
   ExecBatch batch{{}, 1};
   batch.values.resize(kernels_.size() + segment_field_ids_.size());
 
@@ -304,8 +374,7 @@ Status ScalarAggregateNode::OutputResult(bool is_last) {
                          aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
                         {"function.kind", std::string(kind_name()) + "::Finalize"}});
     KernelContext ctx{plan()->query_context()->exec_context()};
-    ARROW_ASSIGN_OR_RAISE(auto merged, ScalarAggregateKernel::MergeAll(
-                                           kernels_[i], &ctx, std::move(states_[i])));
+    ctx.SetState(states_[i][merge_threads_[0]].get());
     RETURN_NOT_OK(kernels_[i]->finalize(&ctx, &batch.values[base + i]));
   }
 
@@ -23,6 +23,7 @@
 #include "arrow/acero/exec_plan_internal.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -96,11 +97,13 @@ Status HandleUnalignedBuffers(ExecBatch* batch, UnalignedBufferHandling handling
 struct SourceNode : ExecNode, public TracedNode {
   SourceNode(ExecPlan* plan, std::shared_ptr<Schema> output_schema,
              AsyncGenerator<std::optional<ExecBatch>> generator,
-             Ordering ordering = Ordering::Unordered())
+             Ordering ordering = Ordering::Unordered(),
+             std::shared_ptr<RuntimeFilterSet> runtime_filters = nullptr)
       : ExecNode(plan, {}, {}, std::move(output_schema)),
         TracedNode(this),
         generator_(std::move(generator)),
-        ordering_(std::move(ordering)) {}
+        ordering_(std::move(ordering)),
+        runtime_filters_(std::move(runtime_filters)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -108,7 +111,8 @@ struct SourceNode : ExecNode, public TracedNode {
     const auto& source_options = checked_cast<const SourceNodeOptions&>(options);
     return plan->EmplaceNode<SourceNode>(plan, source_options.output_schema,
                                          source_options.generator,
-                                         source_options.ordering);
+                                         source_options.ordering,
+                                         source_options.runtime_filters);
   }
 
   const char* kind_name() const override { return "SourceNode"; }
@@ -151,6 +155,10 @@ struct SourceNode : ExecNode, public TracedNode {
                     GetDefaultUnalignedBufferHandling());
             ARROW_RETURN_NOT_OK(
                 HandleUnalignedBuffers(&batch, unaligned_buffer_handling));
+            if (runtime_filters_) {
+              ARROW_ASSIGN_OR_RAISE(batch, runtime_filters_->Apply(
+                                               std::move(batch), plan_->query_context()));
+            }
             if (has_ordering) {
               batch.index = batch_index;
             }
@@ -236,6 +244,14 @@ struct SourceNode : ExecNode, public TracedNode {
 
   const Ordering& ordering() const override { return ordering_; }
 
+  Result<bool> PushRuntimeFilter(const RuntimeFilter& filter) override {
+    if (!runtime_filters_) {
+      return false;
+    }
+    RETURN_NOT_OK(runtime_filters_->Add(filter));
+    return true;
+  }
+
   void PauseProducing(ExecNode* output, int32_t counter) override {
     std::lock_guard<std::mutex> lg(mutex_);
     if (counter <= backpressure_counter_) {
@@ -298,6 +314,7 @@ struct SourceNode : ExecNode, public TracedNode {
   int batch_count_{0};
   const AsyncGenerator<std::optional<ExecBatch>> generator_;
   const Ordering ordering_;
+  const std::shared_ptr<RuntimeFilterSet> runtime_filters_;
 };
 
 struct TableSourceNode : public SourceNode {
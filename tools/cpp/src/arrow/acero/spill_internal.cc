@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/spill_internal.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/acero/partition_util.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+using compute::Hashing32;
+using internal::PlatformFilename;
+
+namespace acero {
+
+SpillFile::SpillFile(QueryContext* ctx, std::string path, std::shared_ptr<Schema> schema)
+    : ctx_(ctx), path_(std::move(path)), schema_(std::move(schema)) {}
+
+SpillFile::~SpillFile() {
+  if (writer_) {
+    ARROW_WARN_NOT_OK(writer_->Close(), "Failed to close spill file");
+  }
+  if (sink_) {
+    ARROW_WARN_NOT_OK(sink_->Close(), "Failed to close spill file");
+  }
+  reader_.reset();
+  // The file may exist without any batch in it if the first Append failed
+  if (created_) {
+    auto maybe_filename = PlatformFilename::FromString(path_);
+    if (maybe_filename.ok()) {
+      ARROW_WARN_NOT_OK(arrow::internal::DeleteFile(*maybe_filename).status(),
+                        "Failed to remove spill file");
+    }
+  }
+}
+
+Status SpillFile::Append(const ExecBatch& batch) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  if (!writer_) {
+    ARROW_ASSIGN_OR_RAISE(sink_, io::FileOutputStream::Open(path_));
+    created_ = true;
+    auto options = ipc::IpcWriteOptions::Defaults();
+    options.memory_pool = ctx_->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(writer_, ipc::MakeStreamWriter(sink_, schema_, options));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        batch.ToRecordBatch(schema_, ctx_->memory_pool()));
+  int64_t batch_size = batch.TotalBufferSize();
+  {
+    auto io_mark = ctx_->ReportTempFileIO(static_cast<size_t>(batch_size));
+    RETURN_NOT_OK(writer_->WriteRecordBatch(*record_batch));
+  }
+  num_batches_ += 1;
+  num_rows_ += batch.length;
+  bytes_written_ += batch_size;
+  return Status::OK();
+}
+
+Status SpillFile::FinishWriting() {
+  if (!writer_) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(writer_->Close());
+  RETURN_NOT_OK(sink_->Close());
+  writer_.reset();
+  sink_.reset();
+  return Status::OK();
+}
+
+Result<std::optional<ExecBatch>> SpillFile::ReadNext() {
+  DCHECK(!writer_) << "FinishWriting must be called before reading a spill file";
+  if (num_batches_ == 0) {
+    return std::nullopt;
+  }
+  if (!reader_) {
+    ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(path_, ctx_->memory_pool()));
+    auto options = ipc::IpcReadOptions::Defaults();
+    options.memory_pool = ctx_->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(reader_,
+                          ipc::RecordBatchStreamReader::Open(std::move(file), options));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader_->Next());
+  if (!record_batch) {
+    return std::nullopt;
+  }
+  return ExecBatch(*record_batch);
+}
+
+Result<util::AccumulationQueue> SpillFile::ReadAll() {
+  util::AccumulationQueue batches;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(std::optional<ExecBatch> batch, ReadNext());
+    if (!batch) {
+      break;
+    }
+    batches.InsertBatch(std::move(*batch));
+  }
+  return batches;
+}
+
+Status HashPartitionedSpill::Init(QueryContext* ctx, size_t num_threads,
+                                  const std::string& directory, const std::string& name,
+                                  std::shared_ptr<Schema> schema,
+                                  std::vector<int> key_ids) {
+  ctx_ = ctx;
+  schema_ = std::move(schema);
+  key_ids_ = std::move(key_ids);
+
+  partitions_.resize(kNumPartitions);
+  for (int i = 0; i < kNumPartitions; ++i) {
+    partitions_[i] = std::make_unique<Partition>();
+    partitions_[i]->file = std::make_unique<SpillFile>(
+        ctx_, directory + name + "-" + std::to_string(i) + ".arrow", schema_);
+  }
+
+  tld_.resize(num_threads);
+  for (auto& local_state : tld_) {
+    RETURN_NOT_OK(
+        local_state.stack.Init(ctx_->memory_pool(), Hashing32::kHashBatchTempStackUsage));
+    local_state.partition_ranges.resize(kNumPartitions + 1);
+  }
+  return Status::OK();
+}
+
+Status HashPartitionedSpill::Append(size_t thread_index, const ExecBatch& batch) {
+  // Partitioning works on arrays and on slices that the row id type can address
+  constexpr int64_t kMaxSliceLength = compute::ExecBatchBuilder::num_rows_max();
+
+  ExecBatch input = batch;
+  for (Datum& value : input.values) {
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(value, MakeArrayFromScalar(*value.scalar(), input.length,
+                                                       ctx_->memory_pool()));
+    }
+  }
+  for (int64_t offset = 0; offset < input.length; offset += kMaxSliceLength) {
+    int64_t length = std::min(input.length - offset, kMaxSliceLength);
+    RETURN_NOT_OK(AppendSlice(thread_index, input.Slice(offset, length)));
+  }
+  return Status::OK();
+}
+
+Status HashPartitionedSpill::AppendSlice(size_t thread_index, const ExecBatch& batch) {
+  DCHECK_LT(thread_index, tld_.size());
+  ThreadLocalState& local_state = tld_[thread_index];
+  int num_rows = static_cast<int>(batch.length);
+
+  std::vector<Datum> key_columns(key_ids_.size());
+  for (size_t i = 0; i < key_ids_.size(); ++i) {
+    key_columns[i] = batch[key_ids_[i]];
+  }
+  ExecBatch key_batch(std::move(key_columns), batch.length);
+
+  local_state.hashes.resize(num_rows);
+  RETURN_NOT_OK(Hashing32::HashBatch(
+      key_batch, local_state.hashes.data(), local_state.temp_column_arrays,
+      ctx_->cpu_info()->hardware_flags(), &local_state.stack, 0, num_rows));
+
+  local_state.row_ids.resize(num_rows);
+  uint16_t* row_ids = local_state.row_ids.data();
+  uint16_t* ranges = local_state.partition_ranges.data();
+  const uint32_t* hashes = local_state.hashes.data();
+  PartitionSort::Eval(
+      num_rows, kNumPartitions, ranges,
+      [hashes](int64_t row_id) { return PartitionId(hashes[row_id]); },
+      [row_ids](int64_t row_id, int pos) {
+        row_ids[pos] = static_cast<uint16_t>(row_id);
+      });
+
+  int num_cols = batch.num_values();
+  for (int i = 0; i < kNumPartitions; ++i) {
+    int num_selected = ranges[i + 1] - ranges[i];
+    if (num_selected == 0) {
+      continue;
+    }
+    Partition& partition = *partitions_[i];
+    std::lock_guard<std::mutex> guard(partition.mutex);
+    if (partition.rows.num_rows() + num_selected >
+        compute::ExecBatchBuilder::num_rows_max()) {
+      RETURN_NOT_OK(partition.file->Append(partition.rows.Flush()));
+    }
+    RETURN_NOT_OK(partition.rows.AppendSelected(ctx_->memory_pool(), batch, num_selected,
+                                                row_ids + ranges[i], num_cols));
+    if (partition.rows.num_rows() >= kSpillBatchLength) {
+      RETURN_NOT_OK(partition.file->Append(partition.rows.Flush()));
+    }
+  }
+  return Status::OK();
+}
+
+Status HashPartitionedSpill::FinishWriting() {
+  for (auto& partition : partitions_) {
+    std::lock_guard<std::mutex> guard(partition->mutex);
+    if (partition->rows.num_rows() > 0) {
+      RETURN_NOT_OK(partition->file->Append(partition->rows.Flush()));
+    }
+    RETURN_NOT_OK(partition->file->FinishWriting());
+  }
+  return Status::OK();
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/ipc/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+using compute::ExecBatch;
+
+/// \brief A temporary file holding batches that did not fit in memory
+///
+/// Batches are written as an Arrow IPC stream and read back in the order they
+/// were appended.  The file is created on the first append and removed when
+/// this object is destroyed.  Calls are not synchronized; callers that share a
+/// file between threads must serialize access to it.
+class SpillFile {
+ public:
+  SpillFile(QueryContext* ctx, std::string path, std::shared_ptr<Schema> schema);
+  ~SpillFile();
+
+  /// \brief Write a batch to the file
+  ///
+  /// The batch must match the schema the file was created with.  Scalar
+  /// columns are broadcast to the length of the batch.
+  Status Append(const ExecBatch& batch);
+
+  /// \brief Close the writer, after which the batches can be read back
+  Status FinishWriting();
+
+  /// \brief Read the next batch, or std::nullopt once all batches have been read
+  Result<std::optional<ExecBatch>> ReadNext();
+
+  /// \brief Read all of the batches that have not been read yet
+  Result<util::AccumulationQueue> ReadAll();
+
+  int64_t num_batches() const { return num_batches_; }
+  int64_t num_rows() const { return num_rows_; }
+  int64_t bytes_written() const { return bytes_written_; }
+
+ private:
+  QueryContext* ctx_;
+  std::string path_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<io::OutputStream> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  std::shared_ptr<RecordBatchReader> reader_;
+  bool created_ = false;
+  int64_t num_batches_ = 0;
+  int64_t num_rows_ = 0;
+  int64_t bytes_written_ = 0;
+};
+
+/// \brief Splits batches by a hash of their key columns and spills every
+///        partition to its own SpillFile
+///
+/// Rows with equal keys always end up in the same partition, even across
+/// different inputs as long as their key columns have the same types.  This lets
+/// an operator that ran out of memory process its input one partition at a time.
+///
+/// Append may be called concurrently from different threads.  Rows are buffered
+/// per partition and written out in batches of kSpillBatchLength rows.
+class HashPartitionedSpill {
+ public:
+  static constexpr int kLogNumPartitions = 5;
+  static constexpr int kNumPartitions = 1 << kLogNumPartitions;
+  static constexpr int kSpillBatchLength = 8 * 1024;
+
+  /// \brief Prepare the partitions
+  ///
+  /// \param ctx the query context, used for memory and temp file accounting
+  /// \param num_threads upper bound on the thread indices passed to Append
+  /// \param directory directory the partition files are created in
+  /// \param name prefix of the partition file names
+  /// \param schema schema of the batches that will be appended
+  /// \param key_ids indices of the columns that rows are partitioned on
+  Status Init(QueryContext* ctx, size_t num_threads, const std::string& directory,
+              const std::string& name, std::shared_ptr<Schema> schema,
+              std::vector<int> key_ids);
+
+  /// \brief Split a batch into partitions and buffer or write out its rows
+  Status Append(size_t thread_index, const ExecBatch& batch);
+
+  /// \brief Write out the rows that are still buffered and close all files
+  Status FinishWriting();
+
+  SpillFile* partition(int i) { return partitions_[i]->file.get(); }
+
+  /// \brief The partition of a row whose key columns hash (Hashing32) to `hash`
+  static int PartitionId(uint32_t hash) {
+    // Remix the hash so that partitions stay independent of the bits hash tables
+    // built on top of a single partition use to find their slots
+    return static_cast<int>((hash * 0x9E3779B1u) >> (32 - kLogNumPartitions));
+  }
+
+  /// \brief Remove the file of a partition that is no longer needed
+  void ReleasePartition(int i) { partitions_[i]->file.reset(); }
+
+ private:
+  struct Partition {
+    std::mutex mutex;
+    compute::ExecBatchBuilder rows;
+    std::unique_ptr<SpillFile> file;
+  };
+
+  struct ThreadLocalState {
+    arrow::util::TempVectorStack stack;
+    std::vector<compute::KeyColumnArray> temp_column_arrays;
+    std::vector<uint32_t> hashes;
+    std::vector<uint16_t> row_ids;
+    std::vector<uint16_t> partition_ranges;
+  };
+
+  Status AppendSlice(size_t thread_index, const ExecBatch& batch);
+
+  QueryContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_ids_;
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  std::vector<ThreadLocalState> tld_;
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/order_by_impl.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+namespace {
+
+class TopKNode : public ExecNode, public TracedNode {
+ public:
+  TopKNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+           std::shared_ptr<Schema> output_schema, TopKNodeOptions options,
+           std::unique_ptr<TopKSelector> selector)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        options_(std::move(options)),
+        output_ordering_(options_.keys.empty() ? options_.ordering
+                                               : Ordering::Implicit()),
+        selector_(std::move(selector)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "TopKNode"));
+
+    const auto& top_k_options = checked_cast<const TopKNodeOptions&>(options);
+    if (top_k_options.ordering.is_implicit() || top_k_options.ordering.is_unordered()) {
+      return Status::Invalid("`ordering` must be an explicit non-empty ordering");
+    }
+    if (top_k_options.k < 0) {
+      return Status::Invalid("`k` must be non-negative");
+    }
+
+    std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
+    QueryContext* ctx = plan->query_context();
+    ARROW_ASSIGN_OR_RAISE(
+        std::unique_ptr<TopKSelector> selector,
+        TopKSelector::Make(ctx->exec_context(), output_schema, top_k_options.ordering,
+                           top_k_options.k, top_k_options.with_ties,
+                           top_k_options.keys, ctx->max_concurrency()));
+    return plan->EmplaceNode<TopKNode>(plan, std::move(inputs), std::move(output_schema),
+                                       top_k_options, std::move(selector));
+  }
+
+  const char* kind_name() const override { return "TopKNode"; }
+
+  const Ordering& ordering() const override { return output_ordering_; }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    // The number of output batches is only known once the rows are selected, in
+    // DoFinish
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                          batch.ToRecordBatch(output_schema_));
+    RETURN_NOT_OK(selector_->Consume(plan_->query_context()->GetThreadIndex(),
+                                     std::move(record_batch)));
+
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status DoFinish() {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> selected, selector_->Finish());
+    selector_.reset();
+
+    TableBatchReader reader(*selected);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    int batch_index = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) {
+        return output_->InputFinished(this, batch_index);
+      }
+      int index = batch_index++;
+      plan_->query_context()->ScheduleTask(
+          [this, batch = std::move(next), index]() mutable {
+            ExecBatch exec_batch(*batch);
+            exec_batch.index = index;
+            return output_->InputReceived(this, std::move(exec_batch));
+          },
+          "TopKNode::ProcessBatch");
+    }
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "k=" << options_.k << ", ordering=" << options_.ordering.ToString();
+    if (options_.with_ties) {
+      ss << ", with_ties";
+    }
+    if (!options_.keys.empty()) {
+      ss << ", keys=[";
+      for (size_t i = 0; i < options_.keys.size(); ++i) {
+        if (i > 0) {
+          ss << ", ";
+        }
+        ss << options_.keys[i].ToString();
+      }
+      ss << "]";
+    }
+    return ss.str();
+  }
+
+ private:
+  AtomicCounter counter_;
+  TopKNodeOptions options_;
+  Ordering output_ordering_;
+  std::unique_ptr<TopKSelector> selector_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterTopKNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(TopKNodeOptions::kName), TopKNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
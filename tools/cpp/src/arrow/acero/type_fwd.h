@@ -28,6 +28,8 @@ class ExecPlan;
 class ExecNodeOptions;
 class ExecFactoryRegistry;
 class QueryContext;
+struct RuntimeFilter;
+class RuntimeFilterSet;
 struct QueryOptions;
 struct Declaration;
 class SinkNodeConsumer;
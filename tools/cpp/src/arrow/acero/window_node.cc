@@ -0,0 +1,1165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/aggregate_internal.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/exec_plan_internal.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::CountOptions;
+using compute::ExecResult;
+using compute::Function;
+using compute::FunctionOptions;
+using compute::Grouper;
+using compute::HashAggregateKernel;
+using compute::KernelContext;
+using compute::KernelInitArgs;
+using compute::KernelState;
+using compute::PairwiseOptions;
+using compute::ScalarAggregateOptions;
+using compute::SortKey;
+using compute::TakeOptions;
+using compute::VectorKernel;
+
+namespace acero {
+namespace {
+
+// Frames of aggregates other than those of FrameAggregate are aggregated by taking the
+// rows of the frames of many output rows at once and aggregating them with a hash
+// aggregate, grouped by output row.  This bounds the number of rows taken at once.
+constexpr int64_t kFrameChunkRows = 1 << 20;
+
+enum class WindowKind { kRowNumber, kLag, kLead, kVector, kAggregate };
+
+// Aggregates whose value for a frame is combined from their values for smaller ranges
+// of rows, so that frames are aggregated without taking their rows
+enum class FrameAggregate { kNone, kSum, kMean, kMin, kMax, kCount };
+
+// A window function resolved against the input schema
+struct BoundWindowFunction {
+  WindowFunction function;
+  WindowKind kind;
+  std::shared_ptr<DataType> type;
+  std::vector<int> target_ids;
+  std::vector<TypeHolder> target_types;
+  // For lag and lead
+  int64_t periods = 1;
+  // For aggregates
+  Aggregate aggregate;
+  const HashAggregateKernel* kernel = NULLPTR;
+  FrameAggregate frame_aggregate = FrameAggregate::kNone;
+};
+
+bool IsWholePartition(const WindowFrame& frame, const Ordering& ordering) {
+  if (!frame.preceding && !frame.following) {
+    return true;
+  }
+  // Without an ordering all rows of a partition are peers
+  return frame.units == WindowFrame::RANGE && ordering.sort_keys().empty();
+}
+
+bool HasRangeOffsets(const WindowFrame& frame) {
+  return frame.units == WindowFrame::RANGE &&
+         ((frame.preceding && *frame.preceding != 0) ||
+          (frame.following && *frame.following != 0));
+}
+
+Result<std::shared_ptr<Array>> ToArray(const Datum& datum, const DataType& type,
+                                       MemoryPool* pool) {
+  if (datum.is_array()) {
+    return datum.make_array();
+  }
+  const ChunkedArray& chunked = *datum.chunked_array();
+  if (chunked.num_chunks() == 1) {
+    return chunked.chunk(0);
+  }
+  if (chunked.num_chunks() == 0) {
+    return MakeEmptyArray(type.GetSharedPtr(), pool);
+  }
+  return Concatenate(chunked.chunks(), pool);
+}
+
+FrameAggregate GetFrameAggregate(const std::string& name,
+                                 const std::vector<TypeHolder>& types,
+                                 const FunctionOptions* options) {
+  if (types.size() != 1) {
+    return FrameAggregate::kNone;
+  }
+  if (name == "count") {
+    bool default_options = !options || std::string_view(options->type_name()) ==
+                                           CountOptions::kTypeName;
+    return default_options ? FrameAggregate::kCount : FrameAggregate::kNone;
+  }
+  if (options &&
+      std::string_view(options->type_name()) != ScalarAggregateOptions::kTypeName) {
+    return FrameAggregate::kNone;
+  }
+  Type::type id = types[0].id();
+  if ((!is_integer(id) && !is_floating(id)) || id == Type::HALF_FLOAT) {
+    return FrameAggregate::kNone;
+  }
+  if (name == "sum") return FrameAggregate::kSum;
+  if (name == "mean") return FrameAggregate::kMean;
+  if (name == "min") return FrameAggregate::kMin;
+  if (name == "max") return FrameAggregate::kMax;
+  return FrameAggregate::kNone;
+}
+
+// The aggregate of a range of rows, with the number of valid and null values in it
+template <typename Acc>
+struct FrameState {
+  Acc value;
+  int64_t count;
+  int64_t null_count;
+};
+
+// Aggregates the frame of every sorted row, combining the aggregates of smaller ranges
+// of rows.  Frames that all start at the start of their partition are aggregated in one
+// pass by extending a running aggregate, which starts over at every partition.  Other
+// frames are aggregated with a segment tree over the rows of each partition, in
+// O(log n) combines per frame.
+template <typename CType, typename Acc, typename Combine, typename Emit>
+void AggregateFrameRanges(const ArraySpan& values,
+                          const std::vector<int64_t>& partition_offsets,
+                          const std::vector<int64_t>& frame_begin,
+                          const std::vector<int64_t>& frame_end, bool cumulative,
+                          Acc identity, Combine&& combine, Emit&& emit) {
+  using State = FrameState<Acc>;
+  const CType* raw_values = values.GetValues<CType>(1);
+  auto leaf = [&](int64_t i) {
+    return values.IsValid(i) ? State{static_cast<Acc>(raw_values[i]), 1, 0}
+                             : State{identity, 0, 1};
+  };
+  auto merge = [&](const State& left, const State& right) {
+    return State{combine(left.value, right.value), left.count + right.count,
+                 left.null_count + right.null_count};
+  };
+  const State empty{identity, 0, 0};
+
+  std::vector<State> tree;
+  for (size_t p = 0; p + 1 < partition_offsets.size(); ++p) {
+    int64_t begin = partition_offsets[p];
+    int64_t end = partition_offsets[p + 1];
+    if (cumulative) {
+      State running = empty;
+      int64_t running_end = begin;
+      for (int64_t i = begin; i < end; ++i) {
+        DCHECK_EQ(frame_begin[i], begin);
+        if (frame_end[i] < running_end) {
+          running = empty;
+          running_end = begin;
+        }
+        for (; running_end < frame_end[i]; ++running_end) {
+          running = merge(running, leaf(running_end));
+        }
+        emit(i, running);
+      }
+      continue;
+    }
+    // The leaves are tree[length] up to tree[2 * length], and tree[k] combines
+    // tree[2 * k] and tree[2 * k + 1]
+    int64_t length = end - begin;
+    tree.resize(2 * length);
+    for (int64_t k = 0; k < length; ++k) {
+      tree[length + k] = leaf(begin + k);
+    }
+    for (int64_t k = length - 1; k > 0; --k) {
+      tree[k] = merge(tree[2 * k], tree[2 * k + 1]);
+    }
+    for (int64_t i = begin; i < end; ++i) {
+      State left = empty;
+      State right = empty;
+      int64_t lo = frame_begin[i] - begin + length;
+      int64_t hi = frame_end[i] - begin + length;
+      for (; lo < hi; lo >>= 1, hi >>= 1) {
+        if (lo & 1) left = merge(left, tree[lo++]);
+        if (hi & 1) right = merge(tree[--hi], right);
+      }
+      emit(i, merge(left, right));
+    }
+  }
+}
+
+template <typename T>
+std::shared_ptr<ArrayData> WrapVector(std::shared_ptr<DataType> type,
+                                      const std::vector<T>& values) {
+  return ArrayData::Make(std::move(type), static_cast<int64_t>(values.size()),
+                         {NULLPTR, Buffer::Wrap(values)}, /*null_count=*/0);
+}
+
+Result<BoundWindowFunction> BindWindowFunction(const WindowFunction& function,
+                                               const Schema& input_schema,
+                                               const Ordering& ordering,
+                                               ExecContext* ctx) {
+  BoundWindowFunction bound;
+  bound.function = function;
+  for (const FieldRef& target : function.target) {
+    ARROW_ASSIGN_OR_RAISE(FieldPath match, target.FindOne(input_schema));
+    bound.target_ids.push_back(match[0]);
+    bound.target_types.emplace_back(input_schema.field(match[0])->type());
+  }
+
+  const std::string& name = function.function;
+  if (name == "row_number") {
+    if (!bound.target_ids.empty()) {
+      return Status::Invalid("The window function row_number takes no arguments");
+    }
+    bound.kind = WindowKind::kRowNumber;
+    bound.type = int64();
+    return bound;
+  }
+  if (name == "lag" || name == "lead") {
+    if (bound.target_ids.size() != 1) {
+      return Status::Invalid("The window function ", name,
+                             " takes exactly one argument");
+    }
+    if (function.options) {
+      if (std::string_view(function.options->type_name()) !=
+          PairwiseOptions::kTypeName) {
+        return Status::Invalid("The window function ", name, " takes ",
+                               PairwiseOptions::kTypeName, ", not ",
+                               function.options->type_name());
+      }
+      bound.periods = checked_cast<const PairwiseOptions&>(*function.options).periods;
+    }
+    if (bound.periods < 0) {
+      return Status::Invalid("The window function ", name,
+                             " needs a non-negative number of periods");
+    }
+    bound.kind = name == "lag" ? WindowKind::kLag : WindowKind::kLead;
+    bound.type = bound.target_types[0].GetSharedPtr();
+    return bound;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Function> resolved,
+                        ctx->func_registry()->GetFunction(name));
+  switch (resolved->kind()) {
+    case Function::VECTOR:
+    case Function::META: {
+      if (bound.target_ids.empty()) {
+        return Status::Invalid("The window function ", name,
+                               " needs at least one argument");
+      }
+      // Find the output type by calling the function on empty input
+      std::vector<Datum> args;
+      for (const TypeHolder& type : bound.target_types) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> empty,
+                              MakeEmptyArray(type.GetSharedPtr(), ctx->memory_pool()));
+        args.emplace_back(std::move(empty));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          Datum out, compute::CallFunction(name, args, function.options.get(), ctx));
+      bound.kind = WindowKind::kVector;
+      bound.type = out.type();
+      return bound;
+    }
+    case Function::SCALAR_AGGREGATE: {
+      const WindowFrame& frame = function.frame;
+      if ((frame.preceding && *frame.preceding < 0) ||
+          (frame.following && *frame.following < 0)) {
+        return Status::Invalid("Window frame offsets must not be negative");
+      }
+      if (HasRangeOffsets(frame) && !IsWholePartition(frame, ordering)) {
+        if (ordering.sort_keys().size() != 1) {
+          return Status::NotImplemented(
+              "RANGE window frames with offsets need exactly one order key");
+        }
+        ARROW_ASSIGN_OR_RAISE(FieldPath match,
+                              ordering.sort_keys()[0].target.FindOne(input_schema));
+        const auto& key_type = input_schema.field(match[0])->type();
+        if (!is_integer(key_type->id()) && !is_floating(key_type->id())) {
+          return Status::NotImplemented(
+              "RANGE window frames with offsets need a numeric order key, not ",
+              key_type->ToString());
+        }
+      }
+      bound.aggregate = Aggregate("hash_" + name, function.options, function.target,
+                                  function.name);
+      ARROW_ASSIGN_OR_RAISE(
+          bound.kernel, aggregate::GetKernel(ctx, bound.aggregate, bound.target_types));
+      std::vector<std::unique_ptr<KernelState>> states(1);
+      ARROW_ASSIGN_OR_RAISE(states[0], aggregate::InitKernel(bound.kernel, ctx,
+                                                             bound.aggregate,
+                                                             bound.target_types));
+      ARROW_ASSIGN_OR_RAISE(
+          FieldVector fields,
+          aggregate::ResolveKernels({bound.aggregate}, {bound.kernel}, states, ctx,
+                                    {bound.target_types}));
+      bound.kind = WindowKind::kAggregate;
+      bound.type = fields[0]->type();
+      bound.frame_aggregate =
+          GetFrameAggregate(name, bound.target_types, function.options.get());
+      return bound;
+    }
+    default:
+      break;
+  }
+  return Status::Invalid("The function ", name, " cannot be used as a window function");
+}
+
+class WindowNode : public ExecNode, public TracedNode {
+ public:
+  WindowNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+             std::shared_ptr<Schema> output_schema, std::vector<int> key_ids,
+             Ordering ordering, std::vector<BoundWindowFunction> functions)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        key_ids_(std::move(key_ids)),
+        ordering_(std::move(ordering)),
+        functions_(std::move(functions)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    if (window_options.ordering.is_implicit()) {
+      return Status::Invalid("The ordering of a window node must be explicit or empty");
+    }
+    const std::shared_ptr<Schema>& input_schema = inputs[0]->output_schema();
+    ExecContext* ctx = plan->query_context()->exec_context();
+
+    std::vector<int> key_ids;
+    for (const FieldRef& key : window_options.partition_keys) {
+      ARROW_ASSIGN_OR_RAISE(FieldPath match, key.FindOne(*input_schema));
+      key_ids.push_back(match[0]);
+    }
+    // Refer to the order keys by index, so that the sort can add the partition first
+    std::vector<SortKey> sort_keys;
+    for (const SortKey& sort_key : window_options.ordering.sort_keys()) {
+      ARROW_ASSIGN_OR_RAISE(FieldPath match, sort_key.target.FindOne(*input_schema));
+      sort_keys.emplace_back(FieldRef(match[0]), sort_key.order);
+    }
+    Ordering ordering(std::move(sort_keys), window_options.ordering.null_placement());
+
+    FieldVector fields = input_schema->fields();
+    std::vector<BoundWindowFunction> functions;
+    for (const WindowFunction& function : window_options.functions) {
+      ARROW_ASSIGN_OR_RAISE(
+          BoundWindowFunction bound,
+          BindWindowFunction(function, *input_schema, window_options.ordering, ctx));
+      const std::string& name = function.name.empty() ? function.function : function.name;
+      fields.push_back(field(name, bound.type));
+      functions.push_back(std::move(bound));
+    }
+
+    return plan->EmplaceNode<WindowNode>(plan, std::move(inputs),
+                                         schema(std::move(fields)), std::move(key_ids),
+                                         std::move(ordering), std::move(functions));
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  // The input batches are output in the order they arrived in, with new columns
+  const Ordering& ordering() const override { return inputs_[0]->ordering(); }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+    {
+      std::lock_guard lk(mutex_);
+      batches_.push_back(std::move(batch));
+    }
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    const Schema& input_schema = *inputs_[0]->output_schema();
+    std::stringstream ss;
+    ss << "functions=[";
+    for (size_t i = 0; i < functions_.size(); ++i) {
+      const BoundWindowFunction& function = functions_[i];
+      ss << (i > 0 ? ", " : "") << function.function.function << '(';
+      for (size_t j = 0; j < function.target_ids.size(); ++j) {
+        ss << (j > 0 ? ", " : "") << input_schema.field(function.target_ids[j])->name();
+      }
+      ss << ')';
+    }
+    ss << "], partition_keys=[";
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      ss << (i > 0 ? ", " : "") << input_schema.field(key_ids_[i])->name();
+    }
+    ss << "], ordering=" << ordering_.ToString();
+    return ss.str();
+  }
+
+ private:
+  Status DoFinish() {
+    if (!inputs_[0]->ordering().is_unordered()) {
+      std::sort(batches_.begin(), batches_.end(),
+                [](const ExecBatch& left, const ExecBatch& right) {
+                  return left.index < right.index;
+                });
+    }
+    for (const ExecBatch& batch : batches_) {
+      num_rows_ += batch.length;
+    }
+
+    RETURN_NOT_OK(PartitionRows());
+    bool needs_sort = false;
+    for (const BoundWindowFunction& function : functions_) {
+      needs_sort |= function.kind != WindowKind::kAggregate ||
+                    !IsWholePartition(function.function.frame, ordering_);
+    }
+    if (needs_sort) {
+      RETURN_NOT_OK(SortRows());
+    }
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (const BoundWindowFunction& function : functions_) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> column, Compute(function));
+      columns.push_back(std::move(column));
+    }
+
+    std::vector<ExecBatch> batches = std::move(batches_);
+    int64_t offset = 0;
+    int num_batches = static_cast<int>(batches.size());
+    for (int i = 0; i < num_batches; ++i) {
+      ExecBatch batch = std::move(batches[i]);
+      for (const auto& column : columns) {
+        batch.values.emplace_back(column->Slice(offset, batch.length));
+      }
+      offset += batch.length;
+      batch.index = i;
+      plan_->query_context()->ScheduleTask(
+          [this, batch = std::move(batch)]() mutable {
+            return output_->InputReceived(this, std::move(batch));
+          },
+          "WindowNode::ProcessBatch");
+    }
+    return output_->InputFinished(this, num_batches);
+  }
+
+  Result<std::shared_ptr<Array>> Compute(const BoundWindowFunction& function) const {
+    switch (function.kind) {
+      case WindowKind::kRowNumber:
+        return RowNumber();
+      case WindowKind::kLag:
+      case WindowKind::kLead:
+        return Shift(function);
+      case WindowKind::kVector:
+        return CallPerPartition(function);
+      case WindowKind::kAggregate:
+        if (IsWholePartition(function.function.frame, ordering_)) {
+          return AggregatePartitions(function);
+        }
+        return AggregateFrames(function);
+    }
+    return Status::UnknownError("Unknown window function kind");
+  }
+
+  ExecContext* exec_context() const { return plan_->query_context()->exec_context(); }
+
+  Status PartitionRows() {
+    partition_ids_.resize(num_rows_);
+    if (key_ids_.empty()) {
+      std::fill(partition_ids_.begin(), partition_ids_.end(), 0);
+      num_partitions_ = num_rows_ > 0 ? 1 : 0;
+      return Status::OK();
+    }
+    std::vector<TypeHolder> key_types;
+    for (int key_id : key_ids_) {
+      key_types.emplace_back(inputs_[0]->output_schema()->field(key_id)->type());
+    }
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Grouper> grouper,
+                          Grouper::Make(key_types, exec_context()));
+    int64_t offset = 0;
+    for (const ExecBatch& batch : batches_) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch keys, batch.SelectValues(key_ids_));
+      ARROW_ASSIGN_OR_RAISE(Datum ids, grouper->Consume(ExecSpan(keys)));
+      const uint32_t* values = ids.array()->GetValues<uint32_t>(1);
+      std::copy(values, values + batch.length, partition_ids_.begin() + offset);
+      offset += batch.length;
+    }
+    num_partitions_ = grouper->num_groups();
+    return Status::OK();
+  }
+
+  // Arranges the rows by partition and then by the ordering.  The rows of partition p
+  // are sorted_rows_[partition_offsets_[p]] up to sorted_rows_[partition_offsets_[p+1]].
+  Status SortRows() {
+    partition_offsets_.assign(num_partitions_ + 1, 0);
+    for (uint32_t id : partition_ids_) {
+      ++partition_offsets_[id + 1];
+    }
+    for (uint32_t p = 0; p < num_partitions_; ++p) {
+      partition_offsets_[p + 1] += partition_offsets_[p];
+    }
+
+    sorted_rows_.resize(num_rows_);
+    if (ordering_.sort_keys().empty()) {
+      // A stable counting sort keeps the rows of each partition in input order
+      std::vector<int64_t> next(partition_offsets_.begin(), partition_offsets_.end() - 1);
+      for (int64_t row = 0; row < num_rows_; ++row) {
+        sorted_rows_[next[partition_ids_[row]]++] = row;
+      }
+    } else {
+      // The sort is stable, so ties also stay in input order
+      FieldVector fields{field("partition", uint32())};
+      ChunkedArrayVector columns{std::make_shared<ChunkedArray>(
+          MakeArray(WrapVector(uint32(), partition_ids_)))};
+      std::vector<SortKey> sort_keys{SortKey(FieldRef(0))};
+      const Schema& input_schema = *inputs_[0]->output_schema();
+      for (const SortKey& sort_key : ordering_.sort_keys()) {
+        int key_id = (*sort_key.target.field_path())[0];
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> column, InputColumn(key_id));
+        sort_keys.emplace_back(FieldRef(static_cast<int>(fields.size())), sort_key.order);
+        fields.push_back(input_schema.field(key_id));
+        columns.push_back(std::move(column));
+      }
+      auto table = Table::Make(schema(std::move(fields)), std::move(columns), num_rows_);
+      SortOptions sort_options(std::move(sort_keys), ordering_.null_placement());
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> indices,
+          compute::SortIndices(Datum(table), sort_options, exec_context()));
+      const uint64_t* values = indices->data()->GetValues<uint64_t>(1);
+      std::copy(values, values + num_rows_, sorted_rows_.begin());
+    }
+
+    std::vector<int64_t> positions(num_rows_);
+    for (int64_t i = 0; i < num_rows_; ++i) {
+      positions[sorted_rows_[i]] = i;
+    }
+    positions_ = std::move(positions);
+    return Status::OK();
+  }
+
+  // Returns the values of an input column in input order
+  Result<std::shared_ptr<ChunkedArray>> InputColumn(int field_id) const {
+    const auto& type = inputs_[0]->output_schema()->field(field_id)->type();
+    ArrayVector chunks;
+    for (const ExecBatch& batch : batches_) {
+      const Datum& value = batch[field_id];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> chunk,
+                              MakeArrayFromScalar(*value.scalar(), batch.length,
+                                                  exec_context()->memory_pool()));
+        chunks.push_back(std::move(chunk));
+      } else {
+        chunks.push_back(value.make_array());
+      }
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), type);
+  }
+
+  // Returns the values of an input column arranged like sorted_rows_
+  Result<std::shared_ptr<Array>> SortedColumn(int field_id) const {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> column, InputColumn(field_id));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          compute::Take(column, WrapVector(int64(), sorted_rows_),
+                                        TakeOptions::NoBoundsCheck(), exec_context()));
+    return ToArray(sorted, *column->type(), exec_context()->memory_pool());
+  }
+
+  // Puts values arranged like sorted_rows_ back into input order
+  Result<std::shared_ptr<Array>> Unsort(const std::shared_ptr<Array>& sorted) const {
+    ARROW_ASSIGN_OR_RAISE(Datum unsorted,
+                          compute::Take(sorted, WrapVector(int64(), positions_),
+                                        TakeOptions::NoBoundsCheck(), exec_context()));
+    return unsorted.make_array();
+  }
+
+  Result<std::shared_ptr<Array>> RowNumber() const {
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> buffer,
+        AllocateBuffer(num_rows_ * sizeof(int64_t), exec_context()->memory_pool()));
+    auto* row_numbers = buffer->mutable_data_as<int64_t>();
+    for (uint32_t p = 0; p < num_partitions_; ++p) {
+      for (int64_t i = partition_offsets_[p]; i < partition_offsets_[p + 1]; ++i) {
+        row_numbers[sorted_rows_[i]] = i - partition_offsets_[p] + 1;
+      }
+    }
+    return MakeArray(ArrayData::Make(int64(), num_rows_, {NULLPTR, std::move(buffer)},
+                                     /*null_count=*/0));
+  }
+
+  // lag and lead take the value of another row of the partition, or null
+  Result<std::shared_ptr<Array>> Shift(const BoundWindowFunction& function) const {
+    MemoryPool* pool = exec_context()->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                          AllocateBuffer(num_rows_ * sizeof(int64_t), pool));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> validity,
+                          AllocateEmptyBitmap(num_rows_, pool));
+    auto* source_rows = indices->mutable_data_as<int64_t>();
+    std::fill(source_rows, source_rows + num_rows_, 0);
+    int64_t shift =
+        function.kind == WindowKind::kLag ? -function.periods : function.periods;
+    for (uint32_t p = 0; p < num_partitions_; ++p) {
+      int64_t begin = partition_offsets_[p];
+      int64_t end = partition_offsets_[p + 1];
+      for (int64_t i = begin; i < end; ++i) {
+        // Compared this way to avoid overflowing on huge periods
+        if (shift < 0 ? i - begin >= -shift : end - i > shift) {
+          source_rows[sorted_rows_[i]] = sorted_rows_[i + shift];
+          bit_util::SetBit(validity->mutable_data(), sorted_rows_[i]);
+        }
+      }
+    }
+    auto index_data = ArrayData::Make(int64(), num_rows_,
+                                      {std::move(validity), std::move(indices)});
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> column,
+                          InputColumn(function.target_ids[0]));
+    ARROW_ASSIGN_OR_RAISE(Datum shifted,
+                          compute::Take(column, index_data, TakeOptions::NoBoundsCheck(),
+                                        exec_context()));
+    return ToArray(shifted, *function.type, pool);
+  }
+
+  // Calls a vector function, such as cumulative_sum, on the rows of each partition.  The
+  // kernel is resolved and initialized once, then run over the slice of the sorted
+  // columns of every partition, so a kernel that accumulates, like the cumulative ones,
+  // starts over at every partition boundary.
+  Result<std::shared_ptr<Array>> CallPerPartition(
+      const BoundWindowFunction& function) const {
+    ExecContext* ctx = exec_context();
+    std::vector<std::shared_ptr<Array>> targets;
+    for (int target_id : function.target_ids) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> target, SortedColumn(target_id));
+      targets.push_back(std::move(target));
+    }
+
+    // Kernels that allocate their own output can be run without an executor.  Others,
+    // and meta functions, are called through the function registry.
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Function> resolved,
+                          ctx->func_registry()->GetFunction(function.function.function));
+    const VectorKernel* kernel = NULLPTR;
+    if (resolved->kind() == Function::VECTOR) {
+      auto maybe_kernel = resolved->DispatchExact(function.target_types);
+      if (maybe_kernel.ok()) {
+        const auto* vector_kernel = static_cast<const VectorKernel*>(*maybe_kernel);
+        if (vector_kernel->null_handling ==
+                compute::NullHandling::COMPUTED_NO_PREALLOCATE &&
+            vector_kernel->mem_allocation == compute::MemAllocation::NO_PREALLOCATE) {
+          kernel = vector_kernel;
+        }
+      }
+    }
+    KernelContext kernel_ctx{ctx};
+    std::unique_ptr<KernelState> state;
+    if (kernel && kernel->init) {
+      const FunctionOptions* options = function.function.options
+                                           ? function.function.options.get()
+                                           : resolved->default_options();
+      ARROW_ASSIGN_OR_RAISE(
+          state, kernel->init(&kernel_ctx,
+                              KernelInitArgs{kernel, function.target_types, options}));
+      kernel_ctx.SetState(state.get());
+    }
+
+    ArrayVector chunks;
+    for (uint32_t p = 0; p < num_partitions_; ++p) {
+      int64_t offset = partition_offsets_[p];
+      int64_t length = partition_offsets_[p + 1] - offset;
+      std::vector<Datum> args;
+      for (const auto& target : targets) {
+        args.emplace_back(target->Slice(offset, length));
+      }
+      std::shared_ptr<Array> chunk;
+      if (kernel) {
+        ExecBatch batch(std::move(args), length);
+        ExecResult out;
+        out.value = std::make_shared<ArrayData>(function.type, length);
+        RETURN_NOT_OK(kernel->exec(&kernel_ctx, ExecSpan(batch), &out));
+        if (!out.is_array_data()) {
+          return Status::Invalid("The window function ", function.function.function,
+                                 " did not return an array");
+        }
+        chunk = MakeArray(out.array_data());
+      } else {
+        ARROW_ASSIGN_OR_RAISE(Datum out, compute::CallFunction(
+                                             function.function.function, args,
+                                             function.function.options.get(), ctx));
+        ARROW_ASSIGN_OR_RAISE(chunk, ToArray(out, *function.type, ctx->memory_pool()));
+      }
+      if (chunk->length() != length) {
+        return Status::Invalid("The window function ", function.function.function,
+                               " returned ", chunk->length(), " values for ", length,
+                               " rows");
+      }
+      chunks.push_back(std::move(chunk));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Array> sorted,
+        ToArray(std::make_shared<ChunkedArray>(std::move(chunks), function.type),
+                *function.type, ctx->memory_pool()));
+    return Unsort(sorted);
+  }
+
+  // Aggregates whole partitions in one pass over the input, then gives every row the
+  // value of its partition
+  Result<std::shared_ptr<Array>> AggregatePartitions(
+      const BoundWindowFunction& function) const {
+    ExecContext* ctx = exec_context();
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<KernelState> state,
+                          aggregate::InitKernel(function.kernel, ctx, function.aggregate,
+                                                function.target_types));
+    KernelContext kernel_ctx{ctx};
+    kernel_ctx.SetState(state.get());
+    RETURN_NOT_OK(function.kernel->resize(&kernel_ctx, num_partitions_));
+    std::shared_ptr<Array> partition_ids =
+        MakeArray(WrapVector(uint32(), partition_ids_));
+    int64_t offset = 0;
+    for (const ExecBatch& batch : batches_) {
+      std::vector<Datum> values;
+      for (int target_id : function.target_ids) {
+        values.push_back(batch[target_id]);
+      }
+      values.emplace_back(partition_ids->Slice(offset, batch.length));
+      offset += batch.length;
+      ExecBatch agg_batch(std::move(values), batch.length);
+      RETURN_NOT_OK(function.kernel->consume(&kernel_ctx, ExecSpan(agg_batch)));
+    }
+    Datum aggregated;
+    RETURN_NOT_OK(function.kernel->finalize(&kernel_ctx, &aggregated));
+    ARROW_ASSIGN_OR_RAISE(Datum broadcast,
+                          compute::Take(aggregated, partition_ids,
+                                        TakeOptions::NoBoundsCheck(), ctx));
+    return broadcast.make_array();
+  }
+
+  // Finds the rows with the same order keys as their neighbours.  A row's peers are
+  // peer_begin[i] up to peer_end[i] in sorted order.
+  Status FindPeers(std::vector<int64_t>* peer_begin,
+                   std::vector<int64_t>* peer_end) const {
+    // A new peer group starts at the start of every partition and wherever a key changes
+    std::vector<bool> starts_group(num_rows_, false);
+    for (uint32_t p = 0; p < num_partitions_; ++p) {
+      if (partition_offsets_[p] < num_rows_) {
+        starts_group[partition_offsets_[p]] = true;
+      }
+    }
+    for (const SortKey& sort_key : ordering_.sort_keys()) {
+      if (num_rows_ < 2) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> keys,
+                            SortedColumn((*sort_key.target.field_path())[0]));
+      std::shared_ptr<Array> previous = keys->Slice(0, num_rows_ - 1);
+      std::shared_ptr<Array> current = keys->Slice(1);
+      ARROW_ASSIGN_OR_RAISE(Datum equal_datum,
+                            compute::CallFunction("equal", {current, previous},
+                                                  exec_context()));
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> equal_array,
+          ToArray(equal_datum, *boolean(), exec_context()->memory_pool()));
+      const auto& equal = checked_cast<const BooleanArray&>(*equal_array);
+      for (int64_t i = 0; i < num_rows_ - 1; ++i) {
+        // Nulls are peers of each other
+        bool same = equal.IsValid(i) ? equal.Value(i)
+                                     : current->IsNull(i) && previous->IsNull(i);
+        if (!same) {
+          starts_group[i + 1] = true;
+        }
+      }
+    }
+    peer_begin->resize(num_rows_);
+    peer_end->resize(num_rows_);
+    for (int64_t i = 0; i < num_rows_; ++i) {
+      (*peer_begin)[i] = starts_group[i] ? i : (*peer_begin)[i - 1];
+    }
+    for (int64_t i = num_rows_ - 1; i >= 0; --i) {
+      (*peer_end)[i] = (i + 1 == num_rows_ || starts_group[i + 1]) ? i + 1
+                                                                   : (*peer_end)[i + 1];
+    }
+    return Status::OK();
+  }
+
+  // Computes the frame of each row, as a range of positions in sorted_rows_
+  Status FindFrames(const WindowFrame& frame, std::vector<int64_t>* frame_begin,
+                    std::vector<int64_t>* frame_end) const {
+    frame_begin->resize(num_rows_);
+    frame_end->resize(num_rows_);
+    std::vector<int64_t> peer_begin, peer_end;
+    if (frame.units == WindowFrame::RANGE) {
+      RETURN_NOT_OK(FindPeers(&peer_begin, &peer_end));
+    }
+    std::shared_ptr<DoubleArray> keys;
+    bool descending = false;
+    if (HasRangeOffsets(frame)) {
+      const SortKey& sort_key = ordering_.sort_keys()[0];
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> sorted,
+                            SortedColumn((*sort_key.target.field_path())[0]));
+      ARROW_ASSIGN_OR_RAISE(Datum cast, compute::Cast(sorted, float64(),
+                                                      compute::CastOptions::Safe(),
+                                                      exec_context()));
+      keys = std::static_pointer_cast<DoubleArray>(cast.make_array());
+      descending = sort_key.order == compute::SortOrder::Descending;
+    }
+
+    for (uint32_t p = 0; p < num_partitions_; ++p) {
+      int64_t begin = partition_offsets_[p];
+      int64_t end = partition_offsets_[p + 1];
+      // Rows with a null or NaN key are only in range of their peers.  They are sorted
+      // together, to one side of the rows with a numeric key.
+      int64_t numeric_begin = begin;
+      int64_t numeric_end = begin;
+      if (keys) {
+        auto is_numeric_key = [&](int64_t i) {
+          return keys->IsValid(i) && !std::isnan(keys->Value(i));
+        };
+        while (numeric_begin < end && !is_numeric_key(numeric_begin)) {
+          ++numeric_begin;
+        }
+        numeric_end = numeric_begin;
+        while (numeric_end < end && is_numeric_key(numeric_end)) {
+          ++numeric_end;
+        }
+      }
+      const double* key_values = keys ? keys->raw_values() : NULLPTR;
+
+      for (int64_t i = begin; i < end; ++i) {
+        int64_t lo = begin;
+        int64_t hi = end;
+        if (frame.units == WindowFrame::ROWS) {
+          if (frame.preceding) {
+            lo = i - begin > *frame.preceding ? i - *frame.preceding : begin;
+          }
+          if (frame.following) {
+            hi = end - i > *frame.following ? i + *frame.following + 1 : end;
+          }
+        } else if (!keys || i < numeric_begin || i >= numeric_end) {
+          if (frame.preceding) lo = peer_begin[i];
+          if (frame.following) hi = peer_end[i];
+        } else {
+          const double* first = key_values + numeric_begin;
+          const double* last = key_values + numeric_end;
+          double key = key_values[i];
+          if (frame.preceding) {
+            // The preceding rows have smaller keys, or larger ones if descending
+            double bound = descending ? key + static_cast<double>(*frame.preceding)
+                                      : key - static_cast<double>(*frame.preceding);
+            lo = descending ? std::lower_bound(first, last, bound, std::greater<>()) -
+                                  key_values
+                            : std::lower_bound(first, last, bound) - key_values;
+          }
+          if (frame.following) {
+            double bound = descending ? key - static_cast<double>(*frame.following)
+                                      : key + static_cast<double>(*frame.following);
+            hi = descending ? std::upper_bound(first, last, bound, std::greater<>()) -
+                                  key_values
+                            : std::upper_bound(first, last, bound) - key_values;
+          }
+        }
+        (*frame_begin)[i] = lo;
+        (*frame_end)[i] = std::max(lo, hi);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Aggregates the frames of a FrameAggregate from the frame bounds, writing the
+  // aggregate of the frame of each row straight to its input position
+  Result<std::shared_ptr<Array>> CombineFrames(
+      const BoundWindowFunction& function, const std::vector<int64_t>& frame_begin,
+      const std::vector<int64_t>& frame_end) const {
+    MemoryPool* pool = exec_context()->memory_pool();
+    const Aggregate& aggregate = function.aggregate;
+    // Frames without a start offset all start at the start of their partition
+    bool cumulative = !function.function.frame.preceding;
+
+    if (function.frame_aggregate == FrameAggregate::kCount) {
+      CountOptions options = aggregate.options
+                                 ? checked_cast<const CountOptions&>(*aggregate.options)
+                                 : CountOptions::Defaults();
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> target,
+                            SortedColumn(function.target_ids[0]));
+      // The number of valid values before each sorted row
+      std::vector<int64_t> valid_before(num_rows_ + 1, 0);
+      for (int64_t i = 0; i < num_rows_; ++i) {
+        valid_before[i + 1] = valid_before[i] + !target->IsNull(i);
+      }
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                            AllocateBuffer(num_rows_ * sizeof(int64_t), pool));
+      auto* counts = buffer->mutable_data_as<int64_t>();
+      for (int64_t i = 0; i < num_rows_; ++i) {
+        int64_t valid = valid_before[frame_end[i]] - valid_before[frame_begin[i]];
+        int64_t all = frame_end[i] - frame_begin[i];
+        counts[sorted_rows_[i]] = options.mode == CountOptions::ONLY_VALID ? valid
+                                  : options.mode == CountOptions::ONLY_NULL
+                                      ? all - valid
+                                      : all;
+      }
+      return MakeArray(ArrayData::Make(int64(), num_rows_,
+                                       {NULLPTR, std::move(buffer)}, /*null_count=*/0));
+    }
+
+    ScalarAggregateOptions options =
+        aggregate.options
+            ? checked_cast<const ScalarAggregateOptions&>(*aggregate.options)
+            : ScalarAggregateOptions::Defaults();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> target,
+                          SortedColumn(function.target_ids[0]));
+    ArraySpan values(*target->data());
+    const int out_width = function.type->byte_width();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(num_rows_ * out_width, pool));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> validity,
+                          AllocateEmptyBitmap(num_rows_, pool));
+    std::memset(buffer->mutable_data(), 0, buffer->size());
+    uint8_t* out_valid = validity->mutable_data();
+
+    auto visit = [&](const auto& type) -> Status {
+      using Type = std::decay_t<decltype(type)>;
+      if constexpr (!is_integer_type<Type>::value && !is_floating_type<Type>::value) {
+        return Status::TypeError("Cannot aggregate window frames of ", type.ToString());
+      } else {
+        using CType = typename TypeTraits<Type>::CType;
+        auto emit_values = [&](auto* out, auto&& finish) {
+          return [&, out, finish](int64_t i, const auto& state) {
+            int64_t row = sorted_rows_[i];
+            bool valid = finish(state, &out[row]) &&
+                         (options.skip_nulls || state.null_count == 0);
+            bit_util::SetBitTo(out_valid, row, valid);
+          };
+        };
+        switch (function.frame_aggregate) {
+          case FrameAggregate::kSum: {
+            using Acc = std::conditional_t<
+                std::is_floating_point_v<CType>, double,
+                std::conditional_t<std::is_signed_v<CType>, int64_t, uint64_t>>;
+            auto* out = buffer->mutable_data_as<Acc>();
+            AggregateFrameRanges<CType, Acc>(
+                values, partition_offsets_, frame_begin, frame_end, cumulative, Acc(0),
+                [](Acc left, Acc right) -> Acc {
+                  if constexpr (std::is_integral_v<Acc>) {
+                    // Integer sums wrap around like those of hash_sum
+                    using Unsigned = std::make_unsigned_t<Acc>;
+                    return static_cast<Acc>(static_cast<Unsigned>(left) +
+                                            static_cast<Unsigned>(right));
+                  } else {
+                    return left + right;
+                  }
+                },
+                emit_values(out, [&](const FrameState<Acc>& state, Acc* value) {
+                  *value = state.value;
+                  return state.count >= options.min_count;
+                }));
+            return Status::OK();
+          }
+          case FrameAggregate::kMean: {
+            auto* out = buffer->mutable_data_as<double>();
+            AggregateFrameRanges<CType, double>(
+                values, partition_offsets_, frame_begin, frame_end, cumulative, 0.0,
+                [](double left, double right) { return left + right; },
+                emit_values(out, [&](const FrameState<double>& state, double* value) {
+                  bool valid = state.count >= options.min_count;
+                  *value = valid ? state.value / static_cast<double>(state.count) : 0;
+                  return valid;
+                }));
+            return Status::OK();
+          }
+          case FrameAggregate::kMin:
+          case FrameAggregate::kMax: {
+            // Like hash_min and hash_max, NaN is only the result of a frame of NaNs
+            bool is_min = function.frame_aggregate == FrameAggregate::kMin;
+            CType identity;
+            if constexpr (std::is_floating_point_v<CType>) {
+              identity = std::numeric_limits<CType>::quiet_NaN();
+            } else {
+              identity = is_min ? std::numeric_limits<CType>::max()
+                                : std::numeric_limits<CType>::min();
+            }
+            auto* out = buffer->mutable_data_as<CType>();
+            AggregateFrameRanges<CType, CType>(
+                values, partition_offsets_, frame_begin, frame_end, cumulative, identity,
+                [is_min](CType left, CType right) -> CType {
+                  if constexpr (std::is_floating_point_v<CType>) {
+                    return is_min ? std::fmin(left, right) : std::fmax(left, right);
+                  } else {
+                    return is_min ? std::min(left, right) : std::max(left, right);
+                  }
+                },
+                emit_values(out, [](const FrameState<CType>& state, CType* value) {
+                  *value = state.value;
+                  return state.count > 0;
+                }));
+            return Status::OK();
+          }
+          default:
+            return Status::UnknownError("Unknown frame aggregate");
+        }
+      }
+    };
+    RETURN_NOT_OK(VisitType(*target->type(), visit));
+    return MakeArray(ArrayData::Make(function.type, num_rows_,
+                                     {std::move(validity), std::move(buffer)}));
+  }
+
+  // Aggregates the frame of every row.  Unless the aggregate is a FrameAggregate, the
+  // rows of the frames of a chunk of output rows are taken together and aggregated with
+  // the output row as the group id.
+  Result<std::shared_ptr<Array>> AggregateFrames(
+      const BoundWindowFunction& function) const {
+    ExecContext* ctx = exec_context();
+    std::vector<int64_t> frame_begin, frame_end;
+    RETURN_NOT_OK(FindFrames(function.function.frame, &frame_begin, &frame_end));
+    if (function.frame_aggregate != FrameAggregate::kNone) {
+      return CombineFrames(function, frame_begin, frame_end);
+    }
+    std::vector<std::shared_ptr<Array>> targets;
+    for (int target_id : function.target_ids) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> target, SortedColumn(target_id));
+      targets.push_back(std::move(target));
+    }
+
+    ArrayVector chunks;
+    std::vector<int64_t> frame_rows;
+    std::vector<uint32_t> group_ids;
+    int64_t chunk_begin = 0;
+    while (chunk_begin < num_rows_) {
+      frame_rows.clear();
+      group_ids.clear();
+      int64_t chunk_end = chunk_begin;
+      while (chunk_end < num_rows_ && chunk_end - chunk_begin < kFrameChunkRows) {
+        int64_t frame_length = frame_end[chunk_end] - frame_begin[chunk_end];
+        if (chunk_end > chunk_begin &&
+            static_cast<int64_t>(frame_rows.size()) + frame_length > kFrameChunkRows) {
+          break;
+        }
+        for (int64_t i = frame_begin[chunk_end]; i < frame_end[chunk_end]; ++i) {
+          frame_rows.push_back(i);
+          group_ids.push_back(static_cast<uint32_t>(chunk_end - chunk_begin));
+        }
+        ++chunk_end;
+      }
+
+      std::vector<Datum> values;
+      for (const auto& target : targets) {
+        ARROW_ASSIGN_OR_RAISE(Datum taken,
+                              compute::Take(target, WrapVector(int64(), frame_rows),
+                                            TakeOptions::NoBoundsCheck(), ctx));
+        values.push_back(std::move(taken));
+      }
+      values.emplace_back(WrapVector(uint32(), group_ids));
+      ExecBatch agg_batch(std::move(values), static_cast<int64_t>(frame_rows.size()));
+
+      ARROW_ASSIGN_OR_RAISE(std::unique_ptr<KernelState> state,
+                            aggregate::InitKernel(function.kernel, ctx,
+                                                  function.aggregate,
+                                                  function.target_types));
+      KernelContext kernel_ctx{ctx};
+      kernel_ctx.SetState(state.get());
+      RETURN_NOT_OK(function.kernel->resize(&kernel_ctx, chunk_end - chunk_begin));
+      RETURN_NOT_OK(function.kernel->consume(&kernel_ctx, ExecSpan(agg_batch)));
+      Datum aggregated;
+      RETURN_NOT_OK(function.kernel->finalize(&kernel_ctx, &aggregated));
+      chunks.push_back(aggregated.make_array());
+      chunk_begin = chunk_end;
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Array> sorted,
+        ToArray(std::make_shared<ChunkedArray>(std::move(chunks), function.type),
+                *function.type, ctx->memory_pool()));
+    return Unsort(sorted);
+  }
+
+  std::vector<int> key_ids_;
+  // The ordering within partitions, with the keys referring to input fields by index
+  Ordering ordering_;
+  std::vector<BoundWindowFunction> functions_;
+
+  AtomicCounter counter_;
+  std::mutex mutex_;
+  std::vector<ExecBatch> batches_;
+
+  int64_t num_rows_ = 0;
+  std::vector<uint32_t> partition_ids_;
+  uint32_t num_partitions_ = 0;
+  std::vector<int64_t> partition_offsets_;
+  // The input rows by partition and ordering, and the position of each input row there
+  std::vector<int64_t> sorted_rows_;
+  std::vector<int64_t> positions_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(
+      registry->AddFactory(std::string(WindowNodeOptions::kName), WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -147,6 +147,106 @@ void ResolveManyUInt64Sorted(benchmark::State& state) {
   ResolveManyBench<uint64_t>(state, true);
 }
 
+// Resolves one logical index at a time, in order (or in reverse), the way an
+// element by element loop over a chunked array does, e.g. over an R vector
+// backed by a chunked array
+struct ResolveEachBenchmark {
+  enum Lookup {
+    // ChunkResolver::Resolve, which starts from the chunk it cached
+    kResolve,
+    // ChunkResolver::ResolveWithHint, starting from the previous location
+    kHint,
+    // Checks the chunk of the previous location and the few chunks after it before
+    // calling Resolve, as the R package's ALTREP vectors do
+    kCursor,
+  };
+  static constexpr int kCursorSteps = 4;
+
+  benchmark::State& state;
+  int64_t chunked_array_length;
+  int64_t num_chunks;
+
+  explicit ResolveEachBenchmark(benchmark::State& state)
+      : state(state),
+        chunked_array_length(state.range(0)),
+        num_chunks(state.range(1)) {}
+
+  std::vector<int64_t> GenChunkedArrayOffsets() {
+    std::vector<int64_t> offsets;
+    offsets.reserve(num_chunks + 1);
+    for (int64_t i = 0; i <= num_chunks; ++i) {
+      offsets.push_back(i * chunked_array_length / num_chunks);
+    }
+    return offsets;
+  }
+
+  void Bench(bool reverse, Lookup lookup) {
+    const std::vector<int64_t> offsets = GenChunkedArrayOffsets();
+    ChunkResolver resolver(offsets);
+    auto walk = [&](int64_t index, ChunkLocation last) {
+      int64_t chunk = last.chunk_index;
+      for (int step = 0; step < kCursorSteps && chunk < num_chunks; ++step, ++chunk) {
+        if (index < offsets[chunk]) {
+          break;
+        }
+        if (index < offsets[chunk + 1]) {
+          return ChunkLocation{chunk, index - offsets[chunk]};
+        }
+      }
+      return resolver.Resolve(index);
+    };
+    for (auto _ : state) {
+      ChunkLocation location{};
+      for (int64_t i = 0; i < chunked_array_length; ++i) {
+        int64_t index = reverse ? chunked_array_length - 1 - i : i;
+        switch (lookup) {
+          case kResolve:
+            location = resolver.Resolve(index);
+            break;
+          case kHint:
+            location = resolver.ResolveWithHint(index, location);
+            break;
+          case kCursor:
+            location = walk(index, location);
+            break;
+        }
+        benchmark::DoNotOptimize(location);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * chunked_array_length);
+  }
+};
+
+void ResolveEachSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"chunked_array_length", "num_chunks"});
+  bench->Args({kChunkedArrayLength, /*num_chunks*/ 100});
+  bench->Args({kChunkedArrayLength, /*num_chunks*/ 10000});
+}
+
+void ResolveEachForward(benchmark::State& state) {
+  ResolveEachBenchmark{state}.Bench(/*reverse=*/false, ResolveEachBenchmark::kResolve);
+}
+
+void ResolveEachForwardWithHint(benchmark::State& state) {
+  ResolveEachBenchmark{state}.Bench(/*reverse=*/false, ResolveEachBenchmark::kHint);
+}
+
+void ResolveEachForwardWithCursor(benchmark::State& state) {
+  ResolveEachBenchmark{state}.Bench(/*reverse=*/false, ResolveEachBenchmark::kCursor);
+}
+
+void ResolveEachReverse(benchmark::State& state) {
+  ResolveEachBenchmark{state}.Bench(/*reverse=*/true, ResolveEachBenchmark::kResolve);
+}
+
+void ResolveEachReverseWithHint(benchmark::State& state) {
+  ResolveEachBenchmark{state}.Bench(/*reverse=*/true, ResolveEachBenchmark::kHint);
+}
+
+void ResolveEachReverseWithCursor(benchmark::State& state) {
+  ResolveEachBenchmark{state}.Bench(/*reverse=*/true, ResolveEachBenchmark::kCursor);
+}
+
 }  // namespace
 
 // We don't benchmark with uint8_t because it's too fast -- any meaningful
@@ -160,4 +260,11 @@ BENCHMARK(ResolveManyUInt16Sorted)->Apply(ResolveManySetArgs<uint16_t>);
 BENCHMARK(ResolveManyUInt32Sorted)->Apply(ResolveManySetArgs<uint32_t>);
 BENCHMARK(ResolveManyUInt64Sorted)->Apply(ResolveManySetArgs<uint64_t>);
 
+BENCHMARK(ResolveEachForward)->Apply(ResolveEachSetArgs);
+BENCHMARK(ResolveEachForwardWithHint)->Apply(ResolveEachSetArgs);
+BENCHMARK(ResolveEachForwardWithCursor)->Apply(ResolveEachSetArgs);
+BENCHMARK(ResolveEachReverse)->Apply(ResolveEachSetArgs);
+BENCHMARK(ResolveEachReverseWithHint)->Apply(ResolveEachSetArgs);
+BENCHMARK(ResolveEachReverseWithCursor)->Apply(ResolveEachSetArgs);
+
 }  // namespace arrow
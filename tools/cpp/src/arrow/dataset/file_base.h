@@ -107,6 +107,9 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file info. Only valid when file source wraps a path.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
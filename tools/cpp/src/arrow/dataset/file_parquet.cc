@@ -17,35 +17,58 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_dict.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/parquet_encryption_config.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
+#ifdef ARROW_S3
+#  include "arrow/filesystem/s3fs.h"
+#endif
 #include "arrow/table.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/config.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
+#include "arrow/util/uri.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
+#include "parquet/column_reader.h"
 #include "parquet/encryption/crypto_factory.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -363,8 +386,322 @@ Result<bool> IsSupportedParquetFile(const ParquetFileFormat& format,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+void CollectConjuncts(const compute::Expression& expr,
+                      std::vector<compute::Expression>* conjuncts) {
+  const compute::Expression::Call* call = expr.call();
+  if (call != nullptr &&
+      (call->function_name == "and_kleene" || call->function_name == "and")) {
+    for (const compute::Expression& argument : call->arguments) {
+      CollectConjuncts(argument, conjuncts);
+    }
+  } else {
+    conjuncts->push_back(expr);
+  }
+}
+
+// A field and the values it must equal for an `==` or `is_in` expression to be true
+struct EqualityLookup {
+  FieldRef ref;
+  // The type the field is cast to before the comparison, if any
+  std::shared_ptr<DataType> cast_to;
+  ScalarVector values;
+};
+
+std::optional<EqualityLookup> GetEqualityLookup(const compute::Expression& expr) {
+  const compute::Expression::Call* call = expr.call();
+  if (call == nullptr) return std::nullopt;
+
+  auto get_field = [](const compute::Expression& argument, EqualityLookup* lookup) {
+    if (const FieldRef* ref = argument.field_ref()) {
+      lookup->ref = *ref;
+      return true;
+    }
+    const compute::Expression::Call* cast = argument.call();
+    if (cast == nullptr || cast->function_name != "cast" ||
+        cast->arguments.size() != 1 || cast->arguments[0].field_ref() == nullptr ||
+        argument.type() == nullptr) {
+      return false;
+    }
+    lookup->ref = *cast->arguments[0].field_ref();
+    lookup->cast_to = argument.type()->GetSharedPtr();
+    return true;
+  };
+
+  EqualityLookup lookup;
+  if (call->function_name == "equal" && call->arguments.size() == 2) {
+    for (size_t field_argument : {0, 1}) {
+      const Datum* literal = call->arguments[1 - field_argument].literal();
+      if (literal != nullptr && literal->is_scalar() &&
+          get_field(call->arguments[field_argument], &lookup)) {
+        lookup.values = {literal->scalar()};
+        return lookup;
+      }
+    }
+  } else if (call->function_name == "is_in" && call->arguments.size() == 1 &&
+             call->options != nullptr) {
+    const auto& options = checked_cast<const compute::SetLookupOptions&>(*call->options);
+    // Null values may match nulls, which Bloom filters do not record
+    if (!options.value_set.is_array() || options.value_set.null_count() != 0 ||
+        !get_field(call->arguments[0], &lookup)) {
+      return std::nullopt;
+    }
+    const std::shared_ptr<Array> value_set = options.value_set.make_array();
+    lookup.values.reserve(value_set->length());
+    for (int64_t i = 0; i < value_set->length(); ++i) {
+      auto maybe_value = value_set->GetScalar(i);
+      if (!maybe_value.ok()) return std::nullopt;
+      lookup.values.push_back(maybe_value.MoveValueUnsafe());
+    }
+    return lookup;
+  }
+  return std::nullopt;
+}
+
+// The hash of `value` as written to the Bloom filter of a column chunk of a field of
+// type `field_type`, or nullopt if the value's representation in the column chunk is
+// not known for sure
+std::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                        const parquet::ColumnDescriptor& descr,
+                                        const DataType& field_type, const Scalar& value) {
+  if (!value.is_valid) return std::nullopt;
+  const DataType& stored_type =
+      field_type.id() == Type::DICTIONARY
+          ? *checked_cast<const DictionaryType&>(field_type).value_type()
+          : field_type;
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+    case parquet::Type::INT64: {
+      int64_t integer;
+      if (stored_type.id() == Type::DATE32 && value.type->id() == Type::DATE32) {
+        integer = checked_cast<const Date32Scalar&>(value).value;
+      } else if (is_integer(stored_type.id()) &&
+                 (is_integer(value.type->id()) || is_floating(value.type->id()))) {
+        // Values of other types, fractional values and values out of the range of
+        // int64 are not hashed
+        auto maybe_integer =
+            Cast(value.GetSharedPtr(), compute::CastOptions::Safe(int64()));
+        if (!maybe_integer.ok()) return std::nullopt;
+        integer = maybe_integer->scalar_as<Int64Scalar>().value;
+      } else {
+        return std::nullopt;
+      }
+      if (descr.physical_type() == parquet::Type::INT32) {
+        return bloom_filter.Hash(static_cast<int32_t>(integer));
+      }
+      return bloom_filter.Hash(integer);
+    }
+    case parquet::Type::BYTE_ARRAY: {
+      if (!(is_base_binary_like(stored_type.id()) ||
+            is_binary_view_like(stored_type.id())) ||
+          !(is_base_binary_like(value.type->id()) ||
+            is_binary_view_like(value.type->id()))) {
+        return std::nullopt;
+      }
+      const parquet::ByteArray byte_array(
+          checked_cast<const BaseBinaryScalar&>(value).view());
+      return bloom_filter.Hash(&byte_array);
+    }
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY: {
+      if (stored_type.id() != Type::FIXED_SIZE_BINARY ||
+          value.type->id() != Type::FIXED_SIZE_BINARY) {
+        return std::nullopt;
+      }
+      const std::string_view view = checked_cast<const BaseBinaryScalar&>(value).view();
+      if (view.size() != static_cast<size_t>(descr.type_length())) return std::nullopt;
+      const parquet::FLBA flba(reinterpret_cast<const uint8_t*>(view.data()));
+      return bloom_filter.Hash(&flba, static_cast<uint32_t>(view.size()));
+    }
+    default:
+      // Floating point values are not hashed since -0.0 == 0.0 but their hashes
+      // differ
+      return std::nullopt;
+  }
+}
+
+// The leaf columns of the file that `filter` refers to, if the filter can be evaluated
+// on them alone: they must be top-level and non-nested, and have the type of the
+// dataset schema.  Returns nullopt otherwise, or if all projected columns are
+// referred to by the filter.
+std::optional<std::vector<int>> LateMaterializedFilterColumns(
+    const parquet::arrow::FileReader& reader, const compute::Expression& filter,
+    const Schema& dataset_schema, const std::vector<int>& column_projection) {
+  const auto& manifest = reader.manifest();
+  std::vector<int> filter_columns;
+  for (const FieldRef& ref : FieldsInExpression(filter)) {
+    auto match = ref.FindOneOrNone(dataset_schema);
+    if (!match.ok() || match->indices().size() != 1) return std::nullopt;
+    const auto& field = dataset_schema.field(match->indices()[0]);
+    const SchemaField* schema_field = nullptr;
+    for (const auto& candidate : manifest.schema_fields) {
+      if (candidate.field->name() != field->name()) continue;
+      // Ambiguous
+      if (schema_field != nullptr) return std::nullopt;
+      schema_field = &candidate;
+    }
+    // Missing from the file, so null
+    if (schema_field == nullptr) continue;
+    if (!schema_field->is_leaf() || !schema_field->field->type()->Equals(field->type())) {
+      return std::nullopt;
+    }
+    filter_columns.push_back(schema_field->column_index);
+  }
+  std::sort(filter_columns.begin(), filter_columns.end());
+  filter_columns.erase(std::unique(filter_columns.begin(), filter_columns.end()),
+                       filter_columns.end());
+  if (filter_columns.empty()) return std::nullopt;
+  for (int column : column_projection) {
+    if (!std::binary_search(filter_columns.begin(), filter_columns.end(), column)) {
+      return filter_columns;
+    }
+  }
+  return std::nullopt;
+}
+
+constexpr int64_t kDefaultParquetMetadataCacheCapacity = 64 << 20;
+
+// The URI of the file at `path` of `filesystem`, to tell apart the files of different
+// buckets, endpoints and subtrees in the metadata cache.  It has no credentials, which
+// S3FileSystem::MakeUri() embeds, since the keys live as long as the process.
+Result<std::string> CacheKeyUri(const fs::FileSystem& filesystem,
+                                const std::string& path) {
+  if (filesystem.type_name() == "subtree") {
+    const auto& subtree = checked_cast<const fs::SubTreeFileSystem&>(filesystem);
+    return CacheKeyUri(*subtree.base_fs(),
+                       fs::internal::ConcatAbstractPath(subtree.base_path(), path));
+  }
+#ifdef ARROW_S3
+  if (filesystem.type_name() == "s3") {
+    const fs::S3Options options =
+        checked_cast<const fs::S3FileSystem&>(filesystem).options();
+    // The path, which starts with the bucket, is last so that no two files have the
+    // same URI
+    return "s3://" + util::UriEscape(options.endpoint_override) + "/" +
+           util::UriEscape(options.region) + "/" + util::UriEscape(options.scheme) + "/" +
+           path;
+  }
+#endif
+  return filesystem.MakeUri(path);
+}
+
+// The footers and Bloom filters of Parquet files, shared by all ParquetFileFormats
+// (see GetParquetMetadataCacheCapacity)
+class ParquetMetadataCache {
+ public:
+  static ParquetMetadataCache* GetInstance() {
+    static ParquetMetadataCache instance;
+    return &instance;
+  }
+
+  // The key of the current version of the file of `source`, if it is known without
+  // reading the file
+  static std::optional<std::string> FileKey(const FileSource& source) {
+    const fs::FileInfo& info = source.file_info();
+    if (source.filesystem() == nullptr || info.size() == fs::kNoSize ||
+        info.mtime() == fs::kNoTime) {
+      return std::nullopt;
+    }
+    auto maybe_uri = CacheKeyUri(*source.filesystem(), info.path());
+    if (!maybe_uri.ok()) return std::nullopt;
+    // The URI is last so that no two files have the same key
+    return std::to_string(info.size()) + ":" +
+           std::to_string(info.mtime().time_since_epoch().count()) + ":" +
+           *maybe_uri;
+  }
+
+  std::shared_ptr<parquet::FileMetaData> GetMetadata(const std::string& file_key) {
+    return Get("F" + file_key).metadata;
+  }
+
+  void PutMetadata(const std::string& file_key,
+                   std::shared_ptr<parquet::FileMetaData> metadata) {
+    const int64_t cost = metadata->EstimatedMemoryUsage();
+    Put("F" + file_key, Entry{std::move(metadata), nullptr}, cost);
+  }
+
+  std::shared_ptr<parquet::BloomFilter> GetBloomFilter(const std::string& file_key,
+                                                       int row_group, int column) {
+    return Get(BloomFilterKey(file_key, row_group, column)).bloom_filter;
+  }
+
+  void PutBloomFilter(const std::string& file_key, int row_group, int column,
+                      std::shared_ptr<parquet::BloomFilter> bloom_filter) {
+    const int64_t cost = bloom_filter->GetBitsetSize();
+    Put(BloomFilterKey(file_key, row_group, column),
+        Entry{nullptr, std::move(bloom_filter)}, cost);
+  }
+
+  int64_t capacity() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.capacity();
+  }
+
+  void SetCapacity(int64_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.SetCapacity(capacity);
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<parquet::FileMetaData> metadata;
+    std::shared_ptr<parquet::BloomFilter> bloom_filter;
+  };
+
+  ParquetMetadataCache() : cache_(kDefaultParquetMetadataCacheCapacity) {}
+
+  static std::string BloomFilterKey(const std::string& file_key, int row_group,
+                                    int column) {
+    return "B" + std::to_string(row_group) + ":" + std::to_string(column) + ":" +
+           file_key;
+  }
+
+  Entry Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Entry* entry = cache_.Find(key);
+    return entry != nullptr ? *entry : Entry{};
+  }
+
+  void Put(std::string key, Entry entry, int64_t cost) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.Replace(std::move(key), std::move(entry), cost);
+  }
+
+  std::mutex mutex_;
+  ::arrow::internal::CostBoundedLruCache<std::string, Entry> cache_;
+};
+
+// The key of `source` in the ParquetMetadataCache, if its footer may be cached when
+// read with `properties`
+std::optional<std::string> MetadataCacheKey(const FileSource& source,
+                                            const parquet::ReaderProperties& properties) {
+  // Decrypted metadata hold the decryptor of the file
+  if (properties.file_decryption_properties() != nullptr) {
+    return std::nullopt;
+  }
+  return ParquetMetadataCache::FileKey(source);
+}
+
+void CacheMetadata(const std::optional<std::string>& file_key,
+                   const std::shared_ptr<parquet::FileMetaData>& metadata) {
+  if (file_key.has_value() && !metadata->is_encryption_algorithm_set()) {
+    ParquetMetadataCache::GetInstance()->PutMetadata(*file_key, metadata);
+  }
+}
+
 }  // namespace
 
+int64_t GetParquetMetadataCacheCapacity() {
+  return ParquetMetadataCache::GetInstance()->capacity();
+}
+
+Status SetParquetMetadataCacheCapacity(int64_t capacity) {
+  if (capacity < 0) {
+    return Status::Invalid("Parquet metadata cache capacity must be non-negative, got ",
+                           capacity);
+  }
+  ParquetMetadataCache::GetInstance()->SetCapacity(capacity);
+  return Status::OK();
+}
+
 std::optional<compute::Expression> ParquetFileFragment::EvaluateStatisticsAsExpression(
     const Field& field, const FieldRef& field_ref,
     const parquet::Statistics& statistics) {
@@ -489,13 +826,21 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), "", nullptr, options->pool);
+  std::shared_ptr<parquet::FileMetaData> file_metadata = metadata;
+  std::optional<std::string> cache_key;
+  if (file_metadata == nullptr) {
+    cache_key = MetadataCacheKey(source, properties);
+    if (cache_key.has_value()) {
+      file_metadata = ParquetMetadataCache::GetInstance()->GetMetadata(*cache_key);
+    }
+  }
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   // `parquet::ParquetFileReader::Open` will not wrap the exception as status,
   // so using `open_parquet_file` to wrap it.
   auto open_parquet_file = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     auto reader = parquet::ParquetFileReader::Open(std::move(input),
-                                                   std::move(properties), metadata);
+                                                   std::move(properties), file_metadata);
     return reader;
     END_PARQUET_CATCH_EXCEPTIONS
   };
@@ -507,6 +852,9 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto reader = std::move(reader_opt).ValueOrDie();
 
   std::shared_ptr<parquet::FileMetaData> reader_metadata = reader->metadata();
+  if (file_metadata == nullptr) {
+    CacheMetadata(cache_key, reader_metadata);
+  }
   auto arrow_properties =
       MakeArrowReaderProperties(*this, *reader_metadata, *options, *parquet_scan_options);
   ARROW_ASSIGN_OR_RAISE(auto arrow_reader,
@@ -531,9 +879,19 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto properties = MakeReaderProperties(*this, parquet_scan_options.get(), source.path(),
                                          source.filesystem(), options->pool);
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
+  std::shared_ptr<parquet::FileMetaData> file_metadata = metadata;
+  std::optional<std::string> cache_key;
+  if (file_metadata == nullptr) {
+    cache_key = MetadataCacheKey(source, properties);
+    if (cache_key.has_value()) {
+      file_metadata = ParquetMetadataCache::GetInstance()->GetMetadata(*cache_key);
+    }
+  }
 
   return source.OpenAsync().Then([self = self, properties = std::move(properties),
-                                  source = source, options = options, metadata = metadata,
+                                  source = source, options = options,
+                                  metadata = std::move(file_metadata),
+                                  cache_key = std::move(cache_key),
                                   parquet_scan_options = parquet_scan_options](
                                      const std::shared_ptr<io::RandomAccessFile>&
                                          input) mutable {
@@ -541,6 +899,9 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
         .Then(
             [=](const std::unique_ptr<parquet::ParquetFileReader>& reader) mutable
             -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
+              if (metadata == nullptr) {
+                CacheMetadata(cache_key, reader->metadata());
+              }
               auto arrow_properties = MakeArrowReaderProperties(
                   *self, *reader->metadata(), *options, *parquet_scan_options);
 
@@ -607,6 +968,389 @@ struct SlicingGenerator {
   std::shared_ptr<State> state;
 };
 
+// Maps the rows of the filter columns of a row group, which hold its candidate rows
+// in order, to the rows of the row group that satisfy the filter.
+class FilterRowSelector {
+ public:
+  explicit FilterRowSelector(parquet::RowRanges candidates)
+      : candidates_(std::move(candidates)) {}
+
+  bool done() const { return position_ == candidates_.num_rows(); }
+  int64_t num_rows_left() const { return candidates_.num_rows() - position_; }
+
+  // Selects the next `length` rows of the filter columns where `mask` is true
+  Status Add(const Datum& mask, int64_t length, MemoryPool* pool) {
+    if (mask.is_scalar()) {
+      const auto& scalar = mask.scalar_as<BooleanScalar>();
+      if (scalar.is_valid && scalar.value) {
+        Select(position_, position_ + length);
+      }
+    } else {
+      const ArrayData& array = *mask.array();
+      std::shared_ptr<Buffer> bits;
+      int64_t offset = array.offset;
+      if (array.GetNullCount() > 0) {
+        ARROW_ASSIGN_OR_RAISE(
+            bits, ::arrow::internal::BitmapAnd(pool, array.buffers[0]->data(),
+                                               array.offset, array.buffers[1]->data(),
+                                               array.offset, array.length, 0));
+        offset = 0;
+      } else {
+        bits = array.buffers[1];
+      }
+      ::arrow::internal::SetBitRunReader runs(bits->data(), offset, array.length);
+      for (auto run = runs.NextRun(); !run.AtEnd(); run = runs.NextRun()) {
+        Select(position_ + run.position, position_ + run.position + run.length);
+      }
+    }
+    position_ += length;
+    return Status::OK();
+  }
+
+  Result<parquet::RowRanges> Finish(int row_group) {
+    if (!done()) {
+      return Status::Invalid("Expected ", candidates_.num_rows(),
+                             " rows of the filter columns of row group ", row_group,
+                             ", got ", position_);
+    }
+    parquet::RowRanges selected(std::move(selected_));
+    for (const auto& [column, offset_index] : candidates_.offset_indexes()) {
+      selected.SetOffsetIndex(column, offset_index);
+    }
+    return selected;
+  }
+
+ private:
+  // Selects the rows [begin, end) of the filter columns
+  void Select(int64_t begin, int64_t end) {
+    const auto& ranges = candidates_.ranges();
+    while (begin < end) {
+      while (candidates_before_ + ranges[candidate_].length() <= begin) {
+        candidates_before_ += ranges[candidate_].length();
+        ++candidate_;
+      }
+      const int64_t run_end =
+          std::min(end, candidates_before_ + ranges[candidate_].length());
+      const int64_t start = ranges[candidate_].start + (begin - candidates_before_);
+      selected_.push_back({start, start + (run_end - begin)});
+      begin = run_end;
+    }
+  }
+
+  parquet::RowRanges candidates_;
+  std::vector<parquet::RowRanges::Range> selected_;
+  int64_t position_ = 0;
+  // The candidate range of the next row to select, and the rows before it
+  size_t candidate_ = 0;
+  int64_t candidates_before_ = 0;
+};
+
+// Reads the row groups of a file in two phases: the columns the filter refers to
+// are decoded and the filter evaluated on them first, then the projected columns
+// are decoded for the rows that satisfy the filter only.  The page index of the
+// projected columns lets the reader skip the pages without any such rows, and the
+// other rows are skipped while decoding.
+//
+// The row groups are read in windows of about as many rows as the scan reads ahead,
+// and each phase reads a window through one async generator, so that CPU threads do
+// not wait on I/O and row groups are read ahead of one another.  The generators of a
+// file run one after the other since each pre-buffers its own column chunks.  Once
+// the filter selects more than kMaxSelectedFraction of the rows of a window, the
+// rest of the file is read in a single pass, which then costs less than decoding
+// the filter columns twice.  The first window is a single row group so that little
+// is decoded twice when that happens.
+struct LateMaterializingGenerator {
+  static constexpr double kMaxSelectedFraction = 0.1;
+
+  struct State : public std::enable_shared_from_this<State> {
+    std::shared_ptr<parquet::arrow::FileReader> reader;
+    std::vector<int> row_groups;
+    // The candidate rows of each row group, or empty for all
+    std::vector<parquet::RowRanges> row_ranges;
+    std::vector<int> filter_columns;
+    std::vector<int> column_projection;
+    compute::Expression filter;
+    std::shared_ptr<Schema> dataset_schema;
+    compute::Expression partition_expression;
+    ::arrow::internal::Executor* cpu_executor;
+    ::arrow::internal::Executor* io_executor;
+    MemoryPool* pool;
+    int64_t batch_size;
+    int64_t rows_to_readahead;
+    size_t next_row_group = 0;
+    // Whether the filter is still selective enough to read in two phases
+    std::atomic<bool> late{true};
+
+    // Evaluates the filter on the values of a dictionary, followed by a null.  Entries
+    // for which the filter is null are not selected.
+    Result<std::shared_ptr<BooleanArray>> EvaluateOnDictionary(
+        const std::shared_ptr<Field>& field, const std::shared_ptr<Array>& dictionary,
+        compute::ExecContext* exec_context) {
+      compute::CastOptions cast_options;
+      cast_options.allow_invalid_utf8 = true;
+      ARROW_ASSIGN_OR_RAISE(
+          auto values, compute::Cast(*dictionary, field->type(), cast_options,
+                                     exec_context));
+      ARROW_ASSIGN_OR_RAISE(auto null, MakeArrayOfNull(field->type(), 1, pool));
+      ARROW_ASSIGN_OR_RAISE(values, Concatenate({values, null}, pool));
+      auto batch = RecordBatch::Make(::arrow::schema({field}), values->length(),
+                                     {std::move(values)});
+      ARROW_ASSIGN_OR_RAISE(
+          auto exec_batch,
+          compute::MakeExecBatch(*dataset_schema, batch, partition_expression));
+      ARROW_ASSIGN_OR_RAISE(
+          Datum mask, compute::ExecuteScalarExpression(filter, exec_batch, exec_context));
+      if (mask.is_scalar()) {
+        const auto& scalar = mask.scalar_as<BooleanScalar>();
+        const BooleanScalar selected(scalar.is_valid && scalar.value);
+        ARROW_ASSIGN_OR_RAISE(auto array,
+                              MakeArrayFromScalar(selected, batch->num_rows(), pool));
+        return checked_pointer_cast<BooleanArray>(std::move(array));
+      }
+      return checked_pointer_cast<BooleanArray>(mask.make_array());
+    }
+
+    // Evaluates the filter, which refers to a single column of the file, on the
+    // dictionary of that column chunk, then selects rows by their dictionary indices
+    // without decoding the values.  If no value matches, only the first index is
+    // decoded.  Returns nullopt unless the column chunk is fully dictionary-encoded.
+    Result<std::optional<parquet::RowRanges>> SelectRowsByDictionary(int row_group) {
+      const int column = filter_columns[0];
+      const SchemaField* schema_field = nullptr;
+      RETURN_NOT_OK(reader->manifest().GetColumnField(column, &schema_field));
+      const std::shared_ptr<Field>& field = schema_field->field;
+      if (!is_base_binary_like(field->type()->id())) return std::nullopt;
+
+      std::shared_ptr<parquet::internal::RecordReader> record_reader;
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      record_reader =
+          reader->parquet_reader()->RowGroup(row_group)->RecordReaderWithExposeEncoding(
+              column, parquet::ExposedEncoding::DICTIONARY);
+      END_PARQUET_CATCH_EXCEPTIONS
+      if (!record_reader->read_dictionary()) return std::nullopt;
+      auto* dictionary_reader =
+          dynamic_cast<parquet::internal::DictionaryRecordReader*>(record_reader.get());
+      DCHECK_NE(dictionary_reader, nullptr);
+
+      compute::ExecContext exec_context(pool);
+      std::vector<parquet::RowRanges::Range> selected;
+      int64_t position = 0;
+      // A fully dictionary-encoded column chunk has a single dictionary, so the filter
+      // is evaluated on it once.  The reader builds a new array of that dictionary for
+      // every batch, so the mask is kept for as long as the length matches rather than
+      // the address.
+      std::shared_ptr<BooleanArray> mask;
+      // Reading one record first loads the dictionary
+      int64_t records_to_read = 1;
+      while (true) {
+        std::shared_ptr<ChunkedArray> chunks;
+        BEGIN_PARQUET_CATCH_EXCEPTIONS
+        record_reader->Reset();
+        if (record_reader->ReadRecords(records_to_read) == 0) break;
+        chunks = dictionary_reader->GetResult();
+        END_PARQUET_CATCH_EXCEPTIONS
+        records_to_read = batch_size;
+
+        for (const auto& chunk : chunks->chunks()) {
+          const auto& dictionary_array = checked_cast<const DictionaryArray&>(*chunk);
+          if (mask == nullptr ||
+              mask->length() != dictionary_array.dictionary()->length() + 1) {
+            ARROW_ASSIGN_OR_RAISE(mask, EvaluateOnDictionary(field,
+                                                             dictionary_array.dictionary(),
+                                                             &exec_context));
+            if (mask->true_count() == 0) return parquet::RowRanges();
+          }
+
+          const int32_t null_entry = static_cast<int32_t>(mask->length() - 1);
+          const auto& indices =
+              checked_cast<const Int32Array&>(*dictionary_array.indices());
+          for (int64_t j = 0; j < indices.length(); ++j) {
+            const int32_t entry = indices.IsValid(j) ? indices.Value(j) : null_entry;
+            if (!mask->IsValid(entry) || !mask->Value(entry)) continue;
+            const int64_t row = position + j;
+            if (!selected.empty() && selected.back().end == row) {
+              ++selected.back().end;
+            } else {
+              selected.push_back({row, row + 1});
+            }
+          }
+          position += indices.length();
+        }
+      }
+      return parquet::RowRanges(std::move(selected));
+    }
+
+    parquet::RowRanges Candidates(size_t i) const {
+      if (!row_ranges.empty()) return row_ranges[i];
+      return parquet::RowRanges::All(
+          reader->parquet_reader()->metadata()->RowGroup(row_groups[i])->num_rows());
+    }
+
+    // The end of the window of row groups that starts at `begin`
+    size_t WindowEnd(size_t begin) const {
+      size_t end = begin + 1;
+      if (begin == 0) return end;
+      int64_t num_rows = Candidates(begin).num_rows();
+      const int64_t window_rows = std::max(rows_to_readahead, batch_size);
+      while (end < row_groups.size() && num_rows < window_rows) {
+        num_rows += Candidates(end++).num_rows();
+      }
+      return end;
+    }
+
+    // The rows of row groups [begin, end) that satisfy the filter.  The dictionary
+    // of a single filter column is read on the I/O executor, since it is read
+    // synchronously, and the filter columns of the other row groups are read
+    // through an async generator.
+    Future<std::vector<parquet::RowRanges>> SelectRows(size_t begin, size_t end) {
+      auto self = shared_from_this();
+      auto selected =
+          std::make_shared<std::vector<std::optional<parquet::RowRanges>>>(end - begin);
+      Future<> dictionaries_read = Future<>::MakeFinished();
+      if (filter_columns.size() == 1) {
+        dictionaries_read = cpu_executor->TransferAlways(
+            DeferNotOk(io_executor->Submit([self, begin, end, selected]() -> Status {
+              for (size_t i = begin; i < end; ++i) {
+                const int row_group = self->row_groups[i];
+                const int64_t num_rows = self->reader->parquet_reader()
+                                             ->metadata()
+                                             ->RowGroup(row_group)
+                                             ->num_rows();
+                if (self->Candidates(i).num_rows() != num_rows) continue;
+                ARROW_ASSIGN_OR_RAISE((*selected)[i - begin],
+                                      self->SelectRowsByDictionary(row_group));
+              }
+              return Status::OK();
+            })));
+      }
+      return dictionaries_read.Then([self, begin, end, selected]() {
+        return self->SelectRowsByFilterColumns(begin, std::move(selected));
+      });
+    }
+
+    // Reads the filter columns of the row groups from `begin` on that have no
+    // selected rows yet, and evaluates the filter on them
+    Future<std::vector<parquet::RowRanges>> SelectRowsByFilterColumns(
+        size_t begin,
+        std::shared_ptr<std::vector<std::optional<parquet::RowRanges>>> selected) {
+      std::vector<int> read_row_groups;
+      std::vector<parquet::RowRanges> read_candidates;
+      auto selectors = std::make_shared<std::vector<FilterRowSelector>>();
+      auto slots = std::make_shared<std::vector<size_t>>();
+      for (size_t slot = 0; slot < selected->size(); ++slot) {
+        if ((*selected)[slot].has_value()) continue;
+        parquet::RowRanges candidates = Candidates(begin + slot);
+        if (candidates.empty()) {
+          (*selected)[slot] = std::move(candidates);
+          continue;
+        }
+        read_row_groups.push_back(row_groups[begin + slot]);
+        selectors->emplace_back(candidates);
+        read_candidates.push_back(std::move(candidates));
+        slots->push_back(slot);
+      }
+
+      auto self = shared_from_this();
+      auto collect = [self, begin, selected, selectors,
+                      slots]() -> Result<std::vector<parquet::RowRanges>> {
+        for (size_t j = 0; j < slots->size(); ++j) {
+          const size_t slot = (*slots)[j];
+          ARROW_ASSIGN_OR_RAISE((*selected)[slot], (*selectors)[j].Finish(
+                                                       self->row_groups[begin + slot]));
+        }
+        std::vector<parquet::RowRanges> rows;
+        for (auto& slot_rows : *selected) {
+          rows.push_back(std::move(*slot_rows));
+        }
+        return rows;
+      };
+      if (read_row_groups.empty()) {
+        return collect();
+      }
+
+      ARROW_ASSIGN_OR_RAISE(
+          auto batches,
+          reader->GetRecordBatchGenerator(reader, std::move(read_row_groups),
+                                          filter_columns, read_candidates,
+                                          cpu_executor, rows_to_readahead));
+      auto exec_context = std::make_shared<compute::ExecContext>(pool);
+      auto current = std::make_shared<size_t>(0);
+      // The batches of a row group are generated in order and do not span row groups
+      auto visit = [self, selectors, current, exec_context](
+                       const std::shared_ptr<RecordBatch>& batch) -> Status {
+        while (*current < selectors->size() && (*selectors)[*current].done()) {
+          ++*current;
+        }
+        if (*current == selectors->size() ||
+            batch->num_rows() > (*selectors)[*current].num_rows_left()) {
+          return Status::Invalid("Got more rows of the filter columns than selected");
+        }
+        ARROW_ASSIGN_OR_RAISE(auto exec_batch,
+                              compute::MakeExecBatch(*self->dataset_schema, batch,
+                                                     self->partition_expression));
+        ARROW_ASSIGN_OR_RAISE(Datum mask,
+                              compute::ExecuteScalarExpression(self->filter, exec_batch,
+                                                               exec_context.get()));
+        return (*selectors)[*current].Add(mask, batch->num_rows(), self->pool);
+      };
+      return VisitAsyncGenerator(std::move(batches), std::move(visit))
+          .Then(std::move(collect));
+    }
+
+    // Reads the projected columns of the row groups from `begin` on in one pass
+    Result<RecordBatchGenerator> ReadInOnePass(size_t begin) {
+      std::vector<int> rest(row_groups.begin() + begin, row_groups.end());
+      std::vector<parquet::RowRanges> rest_ranges;
+      if (!row_ranges.empty()) {
+        rest_ranges.assign(row_ranges.begin() + begin, row_ranges.end());
+      }
+      return reader->GetRecordBatchGenerator(reader, std::move(rest), column_projection,
+                                             rest_ranges, cpu_executor,
+                                             rows_to_readahead);
+    }
+
+    // Reads the projected columns of the selected rows of row groups [begin, end)
+    Result<RecordBatchGenerator> ReadSelectedRows(
+        size_t begin, size_t end, const std::vector<parquet::RowRanges>& selected) {
+      int64_t num_candidates = 0;
+      int64_t num_selected = 0;
+      for (size_t i = begin; i < end; ++i) {
+        num_candidates += Candidates(i).num_rows();
+        num_selected += selected[i - begin].num_rows();
+      }
+      if (static_cast<double>(num_selected) >
+          kMaxSelectedFraction * static_cast<double>(num_candidates)) {
+        late.store(false);
+      }
+      std::vector<int> window(row_groups.begin() + begin, row_groups.begin() + end);
+      return reader->GetRecordBatchGenerator(reader, std::move(window),
+                                             column_projection, selected, cpu_executor,
+                                             rows_to_readahead);
+    }
+  };
+
+  // Generates the batches of a window of row groups.  The next window is only asked
+  // for once all batches of the previous one have been generated.
+  Future<RecordBatchGenerator> operator()() {
+    const size_t begin = state->next_row_group;
+    if (begin == state->row_groups.size()) {
+      return AsyncGeneratorEnd<RecordBatchGenerator>();
+    }
+    if (!state->late.load()) {
+      state->next_row_group = state->row_groups.size();
+      return state->ReadInOnePass(begin);
+    }
+    const size_t end = state->WindowEnd(begin);
+    state->next_row_group = end;
+    return state->SelectRows(begin, end)
+        .Then([state = state, begin, end](const std::vector<parquet::RowRanges>& selected) {
+          return state->ReadSelectedRows(begin, end, selected);
+        });
+  }
+
+  std::shared_ptr<State> state;
+};
+
 Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
@@ -635,20 +1379,58 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
                             parquet_fragment->FilterRowGroups(options->filter));
       if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
     }
+    // Row groups whose Bloom filters hold none of the values looked up are skipped
+    ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroupsByBloomFilters(
+                                          options->filter, std::move(row_groups),
+                                          reader->parquet_reader()));
+    if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
     ARROW_ASSIGN_OR_RAISE(auto column_projection,
                           InferColumnProjection(*reader, *options));
     ARROW_ASSIGN_OR_RAISE(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    // Only the pages that may hold rows satisfying the filter are read; the filter
+    // is still applied to the rows of those pages downstream.
+    ARROW_ASSIGN_OR_RAISE(auto row_ranges,
+                          parquet_fragment->FilterPages(options->filter, row_groups,
+                                                        reader->parquet_reader()));
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * options->batch_size;
     // Use the executor from scan options if provided.
     auto cpu_executor = options->cpu_executor ? options->cpu_executor
                                               : ::arrow::internal::GetCpuThreadPool();
-    ARROW_ASSIGN_OR_RAISE(auto generator, reader->GetRecordBatchGenerator(
-                                              reader, row_groups, column_projection,
-                                              cpu_executor, rows_to_readahead));
+    std::optional<std::vector<int>> filter_columns;
+    if (parquet_scan_options->late_materialization && options->dataset_schema) {
+      filter_columns = LateMaterializedFilterColumns(
+          *reader, options->filter, *options->dataset_schema, column_projection);
+    }
+    RecordBatchGenerator generator;
+    if (filter_columns.has_value()) {
+      auto state = std::make_shared<LateMaterializingGenerator::State>();
+      state->reader = reader;
+      state->row_groups = std::move(row_groups);
+      state->row_ranges = std::move(row_ranges);
+      state->filter_columns = std::move(*filter_columns);
+      state->column_projection = std::move(column_projection);
+      state->partition_expression = parquet_fragment->partition_expression();
+      ARROW_ASSIGN_OR_RAISE(
+          state->filter,
+          SimplifyWithGuarantee(options->filter, state->partition_expression));
+      state->dataset_schema = options->dataset_schema;
+      state->cpu_executor = cpu_executor;
+      state->io_executor = options->io_context.executor();
+      state->pool = options->pool;
+      state->batch_size = options->batch_size;
+      state->rows_to_readahead = rows_to_readahead;
+      generator = MakeConcatenatedGenerator(
+          AsyncGenerator<RecordBatchGenerator>(LateMaterializingGenerator{state}));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(generator,
+                            reader->GetRecordBatchGenerator(
+                                reader, row_groups, column_projection, row_ranges,
+                                cpu_executor, rows_to_readahead));
+    }
     RecordBatchGenerator sliced =
         SlicingGenerator(std::move(generator), options->batch_size);
     if (batch_readahead == 0) {
@@ -983,6 +1765,245 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   return row_groups;
 }
 
+Result<std::vector<parquet::RowRanges>> ParquetFileFragment::FilterPages(
+    compute::Expression predicate, const std::vector<int>& row_groups,
+    parquet::ParquetFileReader* reader) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (row_groups.empty() || !ExpressionHasFieldRefs(predicate)) {
+    return std::vector<parquet::RowRanges>{};
+  }
+
+  // The leaf columns that the predicate refers to
+  std::vector<std::pair<FieldRef, const SchemaField*>> columns;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+
+    if (!schema_field->is_leaf()) continue;
+    columns.emplace_back(ref, schema_field);
+  }
+  if (columns.empty()) {
+    return std::vector<parquet::RowRanges>{};
+  }
+  // The columns point into the manifest, which is kept alive past the lock in case
+  // the cached metadata is cleared meanwhile
+  std::shared_ptr<parquet::FileMetaData> metadata = metadata_;
+  std::shared_ptr<parquet::arrow::SchemaManifest> manifest = manifest_;
+  std::shared_ptr<Schema> physical_schema = physical_schema_;
+  // Reading the page index is blocking I/O, which must not block other users of the
+  // fragment
+  lock.Unlock();
+
+  std::vector<parquet::RowRanges> row_ranges;
+  row_ranges.reserve(row_groups.size());
+  bool some_pages_excluded = false;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  std::shared_ptr<parquet::PageIndexReader> page_index_reader =
+      reader->GetPageIndexReader();
+  for (int row_group : row_groups) {
+    const int64_t num_rows = metadata->RowGroup(row_group)->num_rows();
+    auto rows = parquet::RowRanges::All(num_rows);
+    std::vector<std::pair<int, std::shared_ptr<parquet::OffsetIndex>>> offset_indexes;
+    auto row_group_page_index =
+        page_index_reader != nullptr ? page_index_reader->RowGroup(row_group) : nullptr;
+    for (const auto& [ref, schema_field] : columns) {
+      if (row_group_page_index == nullptr || rows.empty()) break;
+      const int column = schema_field->column_index;
+      auto column_index = row_group_page_index->GetColumnIndex(column);
+      auto offset_index = row_group_page_index->GetOffsetIndex(column);
+      if (column_index == nullptr || offset_index == nullptr) continue;
+      const size_t num_pages = offset_index->page_locations().size();
+      if (column_index->null_pages().size() != num_pages) continue;
+
+      // As for the statistics of a column chunk (see
+      // ColumnChunkMetaData::is_stats_set), min and max are not trusted for an
+      // unknown sort order, nor from writers known to have gotten them wrong
+      const parquet::ColumnDescriptor* descr = metadata->schema()->Column(column);
+      const parquet::SortOrder::type sort_order = descr->sort_order();
+      if (sort_order == parquet::SortOrder::UNKNOWN) continue;
+      const parquet::ApplicationVersion& writer_version = metadata->writer_version();
+
+      std::vector<int32_t> pages;
+      for (size_t page = 0; page < num_pages; ++page) {
+        std::optional<compute::Expression> guarantee;
+        if (column_index->null_pages()[page]) {
+          guarantee = compute::is_null(compute::field_ref(ref));
+        } else {
+          parquet::EncodedStatistics encoded;
+          encoded.set_min(column_index->encoded_min_values()[page]);
+          encoded.set_max(column_index->encoded_max_values()[page]);
+          if (!writer_version.HasCorrectStatistics(descr->physical_type(), encoded,
+                                                   sort_order)) {
+            pages.push_back(static_cast<int32_t>(page));
+            continue;
+          }
+          const bool has_null_count = column_index->has_null_counts();
+          // The number of values of the page is not in the page index, but pages
+          // that are not null pages have some
+          auto statistics = parquet::Statistics::Make(
+              descr, column_index->encoded_min_values()[page],
+              column_index->encoded_max_values()[page], /*num_values=*/1,
+              has_null_count ? column_index->null_counts()[page] : 0,
+              /*distinct_count=*/0, /*has_min_max=*/true, has_null_count,
+              /*has_distinct_count=*/false);
+          guarantee =
+              EvaluateStatisticsAsExpression(*schema_field->field, ref, *statistics);
+        }
+        if (guarantee.has_value()) {
+          ARROW_ASSIGN_OR_RAISE(*guarantee, guarantee->Bind(*physical_schema));
+          ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                                SimplifyWithGuarantee(predicate, *guarantee));
+          if (!page_predicate.IsSatisfiable()) continue;
+        }
+        pages.push_back(static_cast<int32_t>(page));
+      }
+      rows = parquet::RowRanges::Intersect(
+          rows, parquet::RowRanges::FromPages(*offset_index, num_rows, pages));
+      offset_indexes.emplace_back(column, std::move(offset_index));
+    }
+    // The reader needs the offset indexes of the columns it reads to find the pages
+    // of the selected rows, so those loaded here are passed on
+    for (auto& [column, offset_index] : offset_indexes) {
+      rows.SetOffsetIndex(column, std::move(offset_index));
+    }
+    some_pages_excluded |= rows.num_rows() < num_rows;
+    row_ranges.push_back(std::move(rows));
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  if (!some_pages_excluded) {
+    return std::vector<parquet::RowRanges>{};
+  }
+  return row_ranges;
+}
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByBloomFilters(
+    compute::Expression predicate, std::vector<int> row_groups,
+    parquet::ParquetFileReader* reader) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (row_groups.empty() || !ExpressionHasFieldRefs(predicate)) {
+    return row_groups;
+  }
+
+  // The `==` and `is_in` conjuncts of the predicate on leaf columns
+  std::vector<std::pair<EqualityLookup, const SchemaField*>> lookups;
+  std::vector<compute::Expression> conjuncts;
+  CollectConjuncts(predicate, &conjuncts);
+  for (const compute::Expression& conjunct : conjuncts) {
+    std::optional<EqualityLookup> lookup = GetEqualityLookup(conjunct);
+    if (!lookup.has_value()) continue;
+    ARROW_ASSIGN_OR_RAISE(auto match, lookup->ref.FindOneOrNone(*physical_schema_));
+
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+
+    if (!schema_field->is_leaf()) continue;
+    if (lookup->cast_to != nullptr) {
+      // Only comparisons of small integers cast to wider types that represent
+      // them all exactly can be looked up as the integers
+      const DataType& field_type = *schema_field->field->type();
+      if (!is_integer(field_type.id()) || field_type.bit_width() > 32 ||
+          !(lookup->cast_to->id() == Type::DOUBLE ||
+            (is_integer(lookup->cast_to->id()) &&
+             lookup->cast_to->bit_width() >= field_type.bit_width()))) {
+        continue;
+      }
+    }
+    lookups.emplace_back(std::move(*lookup), schema_field);
+  }
+  if (lookups.empty()) {
+    return row_groups;
+  }
+  // The lookups point into the manifest, which is kept alive past the lock in case
+  // the cached metadata is cleared meanwhile
+  std::shared_ptr<parquet::FileMetaData> metadata = metadata_;
+  std::shared_ptr<parquet::arrow::SchemaManifest> manifest = manifest_;
+  std::shared_ptr<parquet::FileMetaData> original_metadata = original_metadata_;
+  // Reading Bloom filters may take many round trips to the file system, which must
+  // not block other users of the fragment
+  lock.Unlock();
+
+  // Bloom filters of files that are not encrypted are shared with the other
+  // fragments of the file, and with later datasets, in the byte-bounded
+  // ParquetMetadataCache; those of other files are read anew on every scan
+  std::optional<std::string> cache_key;
+  if (!metadata->is_encryption_algorithm_set()) {
+    cache_key = ParquetMetadataCache::FileKey(source_);
+  }
+  auto* cache = ParquetMetadataCache::GetInstance();
+
+  std::vector<int> selected;
+  selected.reserve(row_groups.size());
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int row_group : row_groups) {
+    auto row_group_metadata = metadata->RowGroup(row_group);
+    bool may_match = true;
+    for (const auto& [lookup, schema_field] : lookups) {
+      const int column = schema_field->column_index;
+      if (!row_group_metadata->ColumnChunk(column)->bloom_filter_offset()) continue;
+
+      std::shared_ptr<parquet::BloomFilter> bloom_filter;
+      if (cache_key.has_value()) {
+        bloom_filter = cache->GetBloomFilter(*cache_key, row_group, column);
+      }
+      if (bloom_filter == nullptr) {
+        auto row_group_reader = reader->GetBloomFilterReader().RowGroup(row_group);
+        if (row_group_reader != nullptr) {
+          bloom_filter = row_group_reader->GetColumnBloomFilter(column);
+        }
+        if (bloom_filter == nullptr) continue;
+        if (cache_key.has_value()) {
+          cache->PutBloomFilter(*cache_key, row_group, column, bloom_filter);
+        }
+      }
+
+      const parquet::ColumnDescriptor* descr = metadata->schema()->Column(column);
+      bool some_value_may_match = false;
+      for (const std::shared_ptr<Scalar>& value : lookup.values) {
+        std::optional<uint64_t> hash =
+            BloomFilterHash(*bloom_filter, *descr, *schema_field->field->type(), *value);
+        if (!hash.has_value() || bloom_filter->FindHash(*hash)) {
+          some_value_may_match = true;
+          break;
+        }
+      }
+      if (!some_value_may_match) {
+        may_match = false;
+        break;
+      }
+    }
+    if (may_match) {
+      selected.push_back(row_group);
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected;
+}
+
 Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
     compute::Expression predicate) {
   DCHECK_NE(metadata_, nullptr);
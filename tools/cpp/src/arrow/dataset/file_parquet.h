@@ -43,6 +43,7 @@ class FileEncryptionProperties;
 
 class ReaderProperties;
 class ArrowReaderProperties;
+class RowRanges;
 
 class WriterProperties;
 class ArrowWriterProperties;
@@ -66,6 +67,23 @@ struct ParquetEncryptionConfig;
 
 constexpr char kParquetTypeName[] = "parquet";
 
+/// \brief Get the capacity, in bytes, of the process-wide Parquet metadata cache
+///
+/// Parquet file footers and Bloom filters read by any ParquetFileFormat are kept,
+/// least recently used first evicted, in a cache shared by all datasets so that
+/// reopening a dataset does not read them again.  Entries are keyed by the URI
+/// (see FileSystem::MakeUri), size and modification time of the file, and only files
+/// whose FileInfo has a known size and modification time (e.g. discovered by listing
+/// a directory), whose filesystem can make URIs and that are not encrypted are
+/// cached.  Footers are charged an estimate of their size in memory and Bloom filters
+/// the size of their bitset.
+ARROW_DS_EXPORT int64_t GetParquetMetadataCacheCapacity();
+
+/// \brief Set the capacity, in bytes, of the process-wide Parquet metadata cache
+///
+/// A capacity of 0 disables the cache.  Lowering it evicts entries immediately.
+ARROW_DS_EXPORT Status SetParquetMetadataCacheCapacity(int64_t capacity);
+
 /// \brief A FileFormat implementation that reads from Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
@@ -208,6 +226,17 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Return the rows of each of the given row groups that may satisfy the predicate,
+  /// going by the page index (per-page min/max and null counts) of the file, or an
+  /// empty vector if no page can be excluded.
+  Result<std::vector<parquet::RowRanges>> FilterPages(
+      compute::Expression predicate, const std::vector<int>& row_groups,
+      parquet::ParquetFileReader* reader);
+  /// Return the given row groups except those whose column Bloom filters hold none of
+  /// the values that an `==` or `is_in` conjunct of the predicate looks up.
+  Result<std::vector<int>> FilterRowGroupsByBloomFilters(
+      compute::Expression predicate, std::vector<int> row_groups,
+      parquet::ParquetFileReader* reader);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
@@ -248,6 +277,13 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// Whether scans with a filter first decode the columns the filter refers to, and
+  /// the other projected columns only for the rows of each row group that satisfy
+  /// the filter.  Applies to filters on top-level, non-nested columns whose type in
+  /// the file is their type in the dataset schema.  Files whose filter selects more
+  /// than a small fraction of the rows read so far are read the rest of the way in a
+  /// single pass.
+  bool late_materialization = true;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
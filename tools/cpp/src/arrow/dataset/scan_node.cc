@@ -25,9 +25,11 @@
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/expression_internal.h"
+#include "arrow/compute/util.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
@@ -126,7 +128,8 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
            std::shared_ptr<Schema> output_schema)
       : acero::ExecNode(plan, {}, {}, std::move(output_schema)),
         acero::TracedNode(this),
-        options_(std::move(options)) {}
+        options_(std::move(options)),
+        runtime_filters_(std::make_shared<acero::RuntimeFilterSet>(output_schema_)) {}
 
   static Result<ScanV2Options> NormalizeAndValidate(const ScanV2Options& options,
                                                     compute::ExecContext* ctx) {
@@ -195,6 +198,37 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
   Status Init() override { return Status::OK(); }
 
+  Result<bool> PushRuntimeFilter(const acero::RuntimeFilter& filter) override {
+    RETURN_NOT_OK(runtime_filters_->Add(filter));
+    return true;
+  }
+
+  // The scan filter and the runtime filters pushed into the node so far.  Fragments
+  // that start after a filter arrived can skip whatever it rules out.
+  Result<compute::Expression> CurrentFilter() {
+    if (runtime_filters_->empty()) {
+      return options_.filter;
+    }
+    // Runtime filters refer to output columns, which are options_.columns in order
+    ARROW_ASSIGN_OR_RAISE(
+        compute::Expression runtime_filter,
+        compute::ModifyExpression(
+            runtime_filters_->expression(),
+            [this](compute::Expression expr) -> Result<compute::Expression> {
+              if (const FieldRef* ref = expr.field_ref()) {
+                ARROW_ASSIGN_OR_RAISE(FieldPath path, ref->FindOne(*output_schema_));
+                std::vector<int> indices = options_.columns[path[0]].indices();
+                indices.insert(indices.end(), path.indices().begin() + 1,
+                               path.indices().end());
+                return compute::field_ref(FieldPath(std::move(indices)));
+              }
+              return expr;
+            },
+            [](compute::Expression expr, ...) { return expr; }));
+    return compute::and_(options_.filter, std::move(runtime_filter))
+        .Bind(*options_.dataset->schema(), plan_->query_context()->exec_context());
+  }
+
   struct KnownValue {
     std::size_t index;
     Datum value;
@@ -262,6 +296,10 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           scan_->fragment_evolution->EvolveBatch(
               batch, node_->options_.columns, *scan_->scan_request.fragment_selection));
       compute::ExecBatch with_known_values = AddKnownValues(std::move(evolved_batch));
+      ARROW_ASSIGN_OR_RAISE(
+          with_known_values,
+          node_->runtime_filters_->Apply(std::move(with_known_values),
+                                         node_->plan_->query_context()));
       node_->plan_->query_context()->ScheduleTask(
           [node = node_, output_batch = std::move(with_known_values)] {
             return node->output_->InputReceived(node, output_batch);
@@ -339,11 +377,15 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
     Future<> BeginScan(const std::shared_ptr<InspectedFragment>& inspected_fragment) {
       // Based on the fragment's guarantee we may not need to retrieve all the columns
-      compute::Expression fragment_filter = node->options_.filter;
+      ARROW_ASSIGN_OR_RAISE(compute::Expression fragment_filter, node->CurrentFilter());
       ARROW_ASSIGN_OR_RAISE(
           compute::Expression filter_minus_part,
           compute::SimplifyWithGuarantee(std::move(fragment_filter),
                                          fragment->partition_expression()));
+      if (!filter_minus_part.IsSatisfiable()) {
+        // No row of the fragment can pass the filter
+        return Future<>::MakeFinished();
+      }
 
       ARROW_ASSIGN_OR_RAISE(
           ExtractedKnownValues extracted,
@@ -463,6 +505,7 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
  private:
   ScanV2Options options_;
+  std::shared_ptr<acero::RuntimeFilterSet> runtime_filters_;
   std::atomic<int> num_batches_{0};
   std::shared_ptr<util::ThrottledAsyncTaskScheduler> batches_throttle_;
 };
@@ -28,6 +28,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/array/array_primitive.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_aggregate.h"
@@ -292,9 +293,34 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
   std::shared_ptr<Dataset> dataset_;
 };
 
+// Adds the runtime filters that were pushed into the scan before the fragment started
+// to the scan filter, which lets formats such as Parquet skip row groups they rule out.
+// Returns nullptr if they rule out the whole fragment.
+Result<std::shared_ptr<ScanOptions>> AddRuntimeFilters(
+    const std::shared_ptr<ScanOptions>& options, const Fragment& fragment,
+    const acero::RuntimeFilterSet& runtime_filters) {
+  // Filters on the augmented fields cannot be bound to the dataset schema, these are
+  // only applied to the rows
+  auto maybe_filter = compute::and_(options->filter, runtime_filters.expression())
+                          .Bind(*options->dataset_schema);
+  if (!maybe_filter.ok()) {
+    return options;
+  }
+  ARROW_ASSIGN_OR_RAISE(compute::Expression filter,
+                        compute::SimplifyWithGuarantee(maybe_filter.MoveValueUnsafe(),
+                                                       fragment.partition_expression()));
+  if (!filter.IsSatisfiable()) {
+    return nullptr;
+  }
+  auto fragment_options = std::make_shared<ScanOptions>(*options);
+  fragment_options->filter = std::move(filter);
+  return fragment_options;
+}
+
 Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
     const Enumerated<std::shared_ptr<Fragment>>& fragment,
-    const std::shared_ptr<ScanOptions>& options) {
+    std::shared_ptr<ScanOptions> options,
+    const std::shared_ptr<acero::RuntimeFilterSet>& runtime_filters) {
 #ifdef ARROW_WITH_OPENTELEMETRY
   util::tracing::Span span;
   START_SPAN(span, "Scanner::FragmentToBatches",
@@ -305,7 +331,19 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
                  {"arrow.dataset.fragment.type_name", fragment.value->type_name()},
              });
 #endif
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen, fragment.value->ScanBatchesAsync(options));
+  RecordBatchGenerator batch_gen;
+  if (runtime_filters && !runtime_filters->empty()) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment_options,
+                          AddRuntimeFilters(options, *fragment.value, *runtime_filters));
+    if (fragment_options) {
+      options = std::move(fragment_options);
+    } else {
+      batch_gen = MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+  }
+  if (!batch_gen) {
+    ARROW_ASSIGN_OR_RAISE(batch_gen, fragment.value->ScanBatchesAsync(options));
+  }
   ArrayVector columns;
   for (const auto& field : options->dataset_schema->fields()) {
     // TODO(ARROW-7051): use helper to make empty batch
@@ -332,12 +370,13 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
 }
 
 Result<AsyncGenerator<EnumeratedRecordBatchGenerator>> FragmentsToBatches(
-    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options) {
+    FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options,
+    std::shared_ptr<acero::RuntimeFilterSet> runtime_filters = nullptr) {
   auto enumerated_fragment_gen = MakeEnumeratedGenerator(std::move(fragment_gen));
   auto batch_gen_gen =
       MakeMappedGenerator(std::move(enumerated_fragment_gen),
                           [=](const Enumerated<std::shared_ptr<Fragment>>& fragment) {
-                            return FragmentToBatches(fragment, options);
+                            return FragmentToBatches(fragment, options, runtime_filters);
                           });
   PROPAGATE_SPAN_TO_GENERATOR(std::move(batch_gen_gen));
   return batch_gen_gen;
@@ -1026,8 +1065,20 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
   ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
   auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
 
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
-                        FragmentsToBatches(std::move(fragment_gen), scan_options));
+  auto fields = scan_options->dataset_schema->fields();
+  if (scan_options->add_augmented_fields) {
+    for (const auto& aug_field : kAugmentedFields) {
+      fields.push_back(aug_field);
+    }
+  }
+  auto output_schema = schema(std::move(fields));
+
+  // Joins downstream may push filters into the scan once they have seen their build
+  // side, see acero::ExecNode::PushRuntimeFilter
+  auto runtime_filters = std::make_shared<acero::RuntimeFilterSet>(output_schema);
+  ARROW_ASSIGN_OR_RAISE(
+      auto batch_gen_gen,
+      FragmentsToBatches(std::move(fragment_gen), scan_options, runtime_filters));
 
   AsyncGenerator<EnumeratedRecordBatch> merged_batch_gen;
   if (require_sequenced_output) {
@@ -1080,16 +1131,10 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
 
   auto ordering = implicit_ordering ? Ordering::Implicit() : Ordering::Unordered();
 
-  auto fields = scan_options->dataset_schema->fields();
-  if (scan_options->add_augmented_fields) {
-    for (const auto& aug_field : kAugmentedFields) {
-      fields.push_back(aug_field);
-    }
-  }
-
-  return acero::MakeExecNode(
-      "source", plan, {},
-      acero::SourceNodeOptions{schema(std::move(fields)), std::move(gen), ordering});
+  acero::SourceNodeOptions source_options{std::move(output_schema), std::move(gen),
+                                          ordering};
+  source_options.runtime_filters = std::move(runtime_filters);
+  return acero::MakeExecNode("source", plan, {}, source_options);
 }
 
 Result<acero::ExecNode*> MakeAugmentedProjectNode(acero::ExecPlan* plan,
@@ -506,6 +506,11 @@ Result<std::string> SubTreeFileSystem::PathFromUri(const std::string& uri_string
   return base_fs_->PathFromUri(uri_string);
 }
 
+Result<std::string> SubTreeFileSystem::MakeUri(std::string path) const {
+  ARROW_ASSIGN_OR_RAISE(auto real_path, PrependBaseNonEmpty(path));
+  return base_fs_->MakeUri(std::move(real_path));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // SlowFileSystem implementation
 
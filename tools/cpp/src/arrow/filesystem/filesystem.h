@@ -397,6 +397,8 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
 
   Result<std::string> NormalizePath(std::string path) override;
   Result<std::string> PathFromUri(const std::string& uri_string) const override;
+  /// \brief The URI of `path` in the base filesystem
+  Result<std::string> MakeUri(std::string path) const override;
 
   bool Equals(const FileSystem& other) const override;
 
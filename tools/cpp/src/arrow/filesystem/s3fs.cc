@@ -3050,7 +3050,11 @@ Result<std::string> S3FileSystem::PathFromUri(const std::string& uri_string) con
 }
 
 Result<std::string> S3FileSystem::MakeUri(std::string path) const {
-  if (path.length() <= 1 || path[0] != '/') {
+  // Also accept the paths of this filesystem, which start with the bucket
+  if (!path.empty() && path[0] != '/') {
+    path = "/" + path;
+  }
+  if (path.length() <= 1) {
     return Status::Invalid("MakeUri requires an absolute, non-root path, got ", path);
   }
   ARROW_ASSIGN_OR_RAISE(auto uri, util::UriFromAbsolutePath(path));
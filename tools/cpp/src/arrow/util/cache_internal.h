@@ -112,6 +112,110 @@ class LruCache {
   std::unordered_map<Key, ListIt> map_;
 };
 
+// A LRU (Least recently used) replacement cache bounded by the total cost of its
+// items (e.g. their size in bytes) instead of their number
+template <typename Key, typename Value>
+class CostBoundedLruCache {
+ public:
+  explicit CostBoundedLruCache(int64_t capacity) : capacity_(capacity) {}
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(CostBoundedLruCache);
+  ARROW_DEFAULT_MOVE_AND_ASSIGN(CostBoundedLruCache);
+
+  void Clear() {
+    items_.clear();
+    map_.clear();
+    cost_ = 0;
+  }
+
+  int32_t size() const {
+    ARROW_DCHECK_EQ(items_.size(), map_.size());
+    return static_cast<int32_t>(items_.size());
+  }
+
+  // The total cost of the cached items
+  int64_t cost() const { return cost_; }
+
+  int64_t capacity() const { return capacity_; }
+
+  // Evicts least recently used items until the total cost fits the new capacity
+  void SetCapacity(int64_t capacity) {
+    capacity_ = capacity;
+    EvictToCapacity();
+  }
+
+  template <typename K>
+  Value* Find(K&& key) {
+    const auto it = map_.find(key);
+    if (it == map_.end()) {
+      return nullptr;
+    } else {
+      // Found => move item at front of the list
+      auto list_it = it->second;
+      items_.splice(items_.begin(), items_, list_it);
+      return &list_it->value;
+    }
+  }
+
+  // Insert or update the item for `key`, then evict least recently used items
+  // until the total cost fits the capacity.  Returns nullptr, and caches nothing
+  // for `key`, if `cost` alone exceeds the capacity.
+  template <typename K, typename V>
+  Value* Replace(K&& key, V&& value, int64_t cost) {
+    ARROW_DCHECK_GE(cost, 0);
+    auto pair = map_.emplace(std::forward<K>(key), ListIt{});
+    const auto it = pair.first;
+    if (pair.second) {
+      // Inserted => push item at front of the list, and update iterator
+      items_.push_front(Item{&it->first, std::forward<V>(value), cost});
+      it->second = items_.begin();
+    } else {
+      // Already exists => move item at front of the list, and update value
+      auto list_it = it->second;
+      items_.splice(items_.begin(), items_, list_it);
+      cost_ -= list_it->cost;
+      list_it->value = std::forward<V>(value);
+      list_it->cost = cost;
+    }
+    cost_ += cost;
+    if (cost > capacity_) {
+      cost_ -= cost;
+      items_.pop_front();
+      map_.erase(it);
+      return nullptr;
+    }
+    // The item just used is at the front and fits alone, so it is not evicted
+    EvictToCapacity();
+    return &items_.front().value;
+  }
+
+ private:
+  struct Item {
+    // Pointer to the key inside the unordered_map
+    const Key* key;
+    Value value;
+    int64_t cost;
+  };
+  using List = std::list<Item>;
+  using ListIt = typename List::iterator;
+
+  void EvictToCapacity() {
+    while (cost_ > capacity_ && !items_.empty()) {
+      const bool erased = map_.erase(*items_.back().key);
+      ARROW_DCHECK(erased);
+      ARROW_UNUSED(erased);
+      cost_ -= items_.back().cost;
+      items_.pop_back();
+    }
+  }
+
+  int64_t capacity_;
+  int64_t cost_ = 0;
+  // In most to least recently used order
+  std::list<Item> items_;
+  std::unordered_map<Key, ListIt> map_;
+};
+
 namespace detail {
 
 template <typename Key, typename Value, typename Cache, typename Func>
@@ -18,6 +18,7 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -69,6 +70,48 @@ struct QueuedTask {
   }
 };
 
+// The tasks spawned by the tasks running on one ThreadPool worker.  The worker
+// runs them in spawn order from the front, other workers steal from the back.
+struct WorkerQueue {
+  void Push(Task task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(std::move(task));
+  }
+
+  bool Pop(Task* task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tasks.empty()) {
+      return false;
+    }
+    *task = std::move(tasks.front());
+    tasks.pop_front();
+    return true;
+  }
+
+  bool Steal(Task* task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tasks.empty()) {
+      return false;
+    }
+    *task = std::move(tasks.back());
+    tasks.pop_back();
+    return true;
+  }
+
+  bool empty() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return tasks.empty();
+  }
+
+  size_t size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return tasks.size();
+  }
+
+  std::mutex mutex;
+  std::deque<Task> tasks;
+};
+
 }  // namespace
 
 struct SerialExecutor::State {
@@ -408,18 +451,30 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
+  // Tasks spawned from outside the pool, or with a non-default priority
   std::priority_queue<QueuedTask> pending_tasks_;
   uint64_t spawned_tasks_count_ = 0;
+  // Tasks spawned by the tasks running on each worker (see SpawnReal).  The list
+  // is guarded by mutex_, each queue by its own mutex.
+  std::list<WorkerQueue> worker_queues_;
+
+  // The following are read without holding mutex_ when a worker spawns a task,
+  // but only modified while holding it (except tasks_queued_or_running_).
 
   // Desired number of threads
-  int desired_capacity_ = 0;
+  std::atomic<int> desired_capacity_{0};
+  // Number of threads in workers_
+  std::atomic<int> num_workers_{0};
+  // Number of workers waiting on cv_
+  std::atomic<int> num_idle_workers_{0};
 
   // Total number of tasks that are either queued or running
-  int tasks_queued_or_running_ = 0;
+  std::atomic<int> tasks_queued_or_running_{0};
 
   // Are we shutting down?
-  bool please_shutdown_ = false;
-  bool quick_shutdown_ = false;
+  std::atomic<bool> please_shutdown_{false};
+  // Read without holding mutex_ by workers running tasks from their own queue
+  std::atomic<bool> quick_shutdown_{false};
 
   std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
 
@@ -442,15 +497,94 @@ struct ThreadPool::State {
   std::shared_ptr<AtForkHandler> atfork_handler_;
 };
 
+namespace {
+
+// Maximum number of tasks a worker takes from its own queue in a row before it
+// looks at the shared queue again, so that tasks spawned from outside the pool
+// are not starved by tasks that keep spawning tasks.
+constexpr int kMaxWorkerQueueStreak = 64;
+
+thread_local ThreadPool* current_thread_pool_ = nullptr;
+// The queue of the ThreadPool worker running on this thread, if any
+thread_local WorkerQueue* current_worker_queue_ = nullptr;
+
+// Runs a task without holding the pool mutex
+void RunTask(ThreadPool::State* state, Task task) {
+  StopToken* stop_token = &task.stop_token;
+  if (!stop_token->IsStopRequested()) {
+    std::move(task.callable)();
+  } else {
+    if (task.stop_callback) {
+      std::move(task.stop_callback)(stop_token->Poll());
+    }
+  }
+  {
+    auto tmp_task = std::move(task);  // release resources before waiting for lock
+    ARROW_UNUSED(tmp_task);
+  }
+  if (ARROW_PREDICT_FALSE(--state->tasks_queued_or_running_ == 0)) {
+    // Lock so that the notification can't slip in between the check and the wait
+    // in WaitForIdle()
+    std::lock_guard<std::mutex> lock(state->mutex_);
+    state->cv_idle_.notify_all();
+  }
+}
+
+// Takes the next task for the worker owning `own_queue`, with the pool mutex held:
+// from the shared queue first, then from its own queue, and otherwise steals the
+// most recently spawned task of another worker.
+bool TakeTaskUnlocked(ThreadPool::State* state, WorkerQueue* own_queue, Task* task) {
+  if (!state->pending_tasks_.empty()) {
+    *task = std::move(const_cast<Task&>(state->pending_tasks_.top().task));
+    state->pending_tasks_.pop();
+    return true;
+  }
+  if (own_queue->Pop(task)) {
+    return true;
+  }
+  for (auto& queue : state->worker_queues_) {
+    if (&queue != own_queue && queue.Steal(task)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns the number of tasks that are queued, but not running, with the pool mutex
+// held
+int NumQueuedTasksUnlocked(ThreadPool::State* state) {
+  size_t queued = state->pending_tasks_.size();
+  for (auto& queue : state->worker_queues_) {
+    queued += queue.size();
+  }
+  return static_cast<int>(queued);
+}
+
+bool HasTasksUnlocked(ThreadPool::State* state) {
+  if (!state->pending_tasks_.empty()) {
+    return true;
+  }
+  for (auto& queue : state->worker_queues_) {
+    if (!queue.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
-                       std::list<std::thread>::iterator it) {
+                       std::list<std::thread>::iterator it,
+                       std::list<WorkerQueue>::iterator queue) {
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  current_worker_queue_ = &*queue;
 
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
@@ -462,46 +596,55 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
 
-    // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
-      if (should_secede()) {
-        break;
-      }
-
+    // Execute pending tasks if any.  We check for secession opportunistically
+    // at each loop iteration since the lock is released below.
+    Task task;
+    while (!state->quick_shutdown_ && !should_secede() &&
+           TakeTaskUnlocked(state.get(), &*queue, &task)) {
       DCHECK_GE(state->tasks_queued_or_running_, 0);
-      {
-        Task task = std::move(const_cast<Task&>(state->pending_tasks_.top().task));
-        state->pending_tasks_.pop();
-        StopToken* stop_token = &task.stop_token;
-        lock.unlock();
-        if (!stop_token->IsStopRequested()) {
-          std::move(task.callable)();
-        } else {
-          if (task.stop_callback) {
-            std::move(task.stop_callback)(stop_token->Poll());
-          }
-        }
-        {
-          auto tmp_task = std::move(task);  // release resources before waiting for lock
-          ARROW_UNUSED(tmp_task);
-        }
-        lock.lock();
-      }
-      if (ARROW_PREDICT_FALSE(--state->tasks_queued_or_running_ == 0)) {
-        state->cv_idle_.notify_all();
+      lock.unlock();
+      RunTask(state.get(), std::move(task));
+      // The tasks spawned by the task just run likely consume its output: run them
+      // right away on this thread, while that output is still in cache.  The lock
+      // is not held, so a quick shutdown or a lower capacity is seen through the
+      // atomic counters.
+      for (int i = 0; i < kMaxWorkerQueueStreak && !state->quick_shutdown_ &&
+                      state->num_workers_ <= state->desired_capacity_ &&
+                      queue->Pop(&task);
+           ++i) {
+        RunTask(state.get(), std::move(task));
       }
+      lock.lock();
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
+    // Now either there are no tasks *or* a quick shutdown was requested
     if (state->please_shutdown_ || should_secede()) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    // Wait for next wakeup, unless a worker spawned a task since we last looked.
+    // A spawning worker checks num_idle_workers_ after pushing its task, and
+    // notifies while holding the lock.
+    ++state->num_idle_workers_;
+    if (!HasTasksUnlocked(state.get())) {
+      state->cv_.wait(lock);
+    }
+    --state->num_idle_workers_;
   }
   DCHECK_GE(state->tasks_queued_or_running_, 0);
 
+  // Hand the tasks left in our queue over to the other workers (they are dropped
+  // on a quick shutdown)
+  current_worker_queue_ = nullptr;
+  bool handed_over = false;
+  for (auto& task : queue->tasks) {
+    state->pending_tasks_.push(QueuedTask{std::move(task), /*priority=*/0,
+                                          state->spawned_tasks_count_++});
+    handed_over = true;
+  }
+  state->worker_queues_.erase(queue);
+  if (handed_over) {
+    state->cv_.notify_all();
+  }
+
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
   // 1) the thread object doesn't get destroyed before this function finishes
@@ -512,6 +655,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
+  --state->num_workers_;
   if (state->please_shutdown_) {
     // Notify the function waiting in Shutdown().
     state->cv_shutdown_.notify_one();
@@ -574,8 +718,9 @@ Status ThreadPool::SetCapacity(int threads) {
   CollectFinishedWorkersUnlocked();
 
   state_->desired_capacity_ = threads;
-  // See if we need to increase or decrease the number of running threads
-  const int required = std::min(static_cast<int>(state_->pending_tasks_.size()),
+  // See if we need to increase or decrease the number of running threads.  Running
+  // tasks already have a worker, so only the queued ones need new workers.
+  const int required = std::min(NumQueuedTasksUnlocked(state_),
                                 threads - static_cast<int>(state_->workers_.size()));
   if (required > 0) {
     // Some tasks are pending, spawn the number of needed threads immediately
@@ -592,10 +737,7 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
-int ThreadPool::GetNumTasks() {
-  std::unique_lock<std::mutex> lock(state_->mutex_);
-  return state_->tasks_queued_or_running_;
-}
+int ThreadPool::GetNumTasks() { return state_->tasks_queued_or_running_; }
 
 int ThreadPool::GetActualCapacity() {
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -630,8 +772,6 @@ void ThreadPool::CollectFinishedWorkersUnlocked() {
   state_->finished_workers_.clear();
 }
 
-thread_local ThreadPool* current_thread_pool_ = nullptr;
-
 bool ThreadPool::OwnsThisThread() { return current_thread_pool_ == this; }
 
 void ThreadPool::LaunchWorkersUnlocked(int threads) {
@@ -640,9 +780,12 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([this, state, it] {
+    state_->worker_queues_.emplace_back();
+    auto queue = --(state_->worker_queues_.end());
+    ++state_->num_workers_;
+    *it = std::thread([this, state, it, queue] {
       current_thread_pool_ = this;
-      WorkerLoop(state, it);
+      WorkerLoop(state, it, queue);
     });
   }
 }
@@ -666,6 +809,31 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
               ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
     task = std::move(wrapper);
 #  endif
+    if (hints.priority == 0 && current_worker_queue_ != nullptr &&
+        current_thread_pool_ == this) {
+      // Spawned by a task of this pool: the new task most likely consumes what
+      // its parent just produced, so keep it on this worker's queue rather than
+      // the shared one.  Idle workers steal from that queue.
+      if (state_->please_shutdown_) {
+        return Status::Invalid("operation forbidden during or after shutdown");
+      }
+      state_->tasks_queued_or_running_++;
+      current_worker_queue_->Push(
+          Task{std::move(task), std::move(stop_token), std::move(stop_callback)});
+      if (state_->num_idle_workers_ > 0 ||
+          state_->num_workers_ < std::min(state_->desired_capacity_.load(),
+                                          state_->tasks_queued_or_running_.load())) {
+        std::lock_guard<std::mutex> lock(state_->mutex_);
+        if (static_cast<int>(state_->workers_.size()) <
+                state_->tasks_queued_or_running_ &&
+            state_->desired_capacity_ > static_cast<int>(state_->workers_.size()) &&
+            !state_->please_shutdown_) {
+          LaunchWorkersUnlocked(/*threads=*/1);
+        }
+        state_->cv_.notify_one();
+      }
+      return Status::OK();
+    }
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
@@ -440,6 +440,10 @@ class ARROW_EXPORT SerialExecutor : public Executor {
 /// An Executor implementation spawning tasks in FIFO manner on a fixed-size
 /// pool of worker threads.
 ///
+/// Tasks spawned with the default priority by a task running on the pool are queued
+/// on the spawning worker, which runs them next (in FIFO order) while their input is
+/// still in its cache; idle workers steal them.  Other tasks go through a shared queue.
+///
 /// Note: Any sort of nested parallelism will deadlock this executor.  Blocking waits are
 /// fine but if one task needs to wait for another task it must be expressed as an
 /// asynchronous continuation.
@@ -103,6 +103,44 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn with tasks spawning their successor from within the
+// pool, as pipelines processing morsels of data do (e.g. scan -> filter -> aggregate)
+static void ThreadPoolSpawnPipelined(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+  constexpr int kStages = 3;
+
+  Workload workload(workload_size);
+
+  const int32_t nmorsels = 100000000 / (workload_size * kStages) + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool;
+    pool = *ThreadPool::Make(nthreads);
+    state.ResumeTiming();
+
+    std::function<void(int)> run_stage = [&](int stage) {
+      workload();
+      if (stage + 1 < kStages) {
+        ABORT_NOT_OK(pool->Spawn([&run_stage, stage] { run_stage(stage + 1); }));
+      }
+    };
+    for (int32_t i = 0; i < nmorsels; ++i) {
+      ABORT_NOT_OK(pool->Spawn([&run_stage] { run_stage(0); }));
+    }
+
+    // Tasks can't be spawned during shutdown, wait for the pipelines to drain first
+    pool->WaitForIdle();
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nmorsels * kStages);
+}
+
 // Benchmark SerialExecutor::RunInSerialExecutor
 static void RunInSerialExecutor(benchmark::State& state) {  // NOLINT non-const reference
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -218,6 +256,17 @@ static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   b->UseRealTime();
 }
 
+// Thread counts up to the core counts of large servers, to show how the pool scales
+static void ThreadPoolScaling_Customize(benchmark::internal::Benchmark* b) {
+  for (const int32_t w : kWorkloadSizes) {
+    for (const int nthreads : {1, 2, 4, 8, 16, 32, 64}) {
+      b->Args({nthreads, w});
+    }
+  }
+  b->ArgNames({"threads", "task_cost"});
+  b->UseRealTime();
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 
 // This benchmark simply provides a baseline indicating the raw cost of our workload
@@ -241,6 +290,7 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(RunInSerialExecutor)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolSpawnPipelined)->Apply(ThreadPoolScaling_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadPoolSubmit)->Apply(ThreadPoolSpawn_Customize);
 
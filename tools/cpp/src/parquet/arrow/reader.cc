@@ -210,6 +210,7 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
+                        std::shared_ptr<const RowSelection> row_selection,
                         std::unique_ptr<ColumnReaderImpl>* out) {
     // Should be covered by GetRecordBatchReader checks but
     // manifest_.schema_fields is a separate variable so be extra careful.
@@ -227,11 +228,13 @@ class FileReaderImpl : public FileReader {
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     ctx->reader_properties = &reader_properties_;
+    ctx->row_selection = std::move(row_selection);
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
                          const std::vector<int>& row_groups,
+                         const std::shared_ptr<const RowSelection>& row_selection,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
                          std::shared_ptr<::arrow::Schema>* out_schema) {
     // We only need to read schema fields which have columns indicated
@@ -245,8 +248,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   row_selection, &reader));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -256,6 +259,97 @@ class FileReaderImpl : public FileReader {
     return Status::OK();
   }
 
+  // Checks row_ranges against row_groups, removes the row groups without selected
+  // rows from row_groups and gets the offset indexes of the column chunks of the
+  // partially selected ones, from row_ranges or else from the page index.  Returns null if the remaining row groups are read in
+  // full.
+  Result<std::shared_ptr<const RowSelection>> MakeRowSelection(
+      std::vector<int>* row_groups, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges) {
+    if (row_ranges.empty()) {
+      return nullptr;
+    }
+    if (row_ranges.size() != row_groups->size()) {
+      return Status::Invalid("Got row ranges for ", row_ranges.size(),
+                             " row groups, expected ", row_groups->size());
+    }
+    auto selection = std::make_shared<RowSelection>();
+    std::vector<int> selected_row_groups;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::shared_ptr<PageIndexReader> page_index_reader;
+    for (size_t i = 0; i < row_groups->size(); ++i) {
+      const int row_group = (*row_groups)[i];
+      const int64_t num_rows = reader_->metadata()->RowGroup(row_group)->num_rows();
+      if (!row_ranges[i].IsWithin(num_rows)) {
+        return Status::Invalid("Row ranges ", row_ranges[i].ToString(),
+                               " are not within the ", num_rows, " rows of row group ",
+                               row_group);
+      }
+      if (row_ranges[i].empty()) {
+        continue;
+      }
+      selected_row_groups.push_back(row_group);
+      if (row_ranges[i].num_rows() == num_rows) {
+        continue;
+      }
+      if (!selection->row_ranges.emplace(row_group, row_ranges[i]).second) {
+        return Status::NotImplemented("Reading some rows of row group ", row_group,
+                                      " more than once");
+      }
+      // The offset indexes that were loaded to compute the row ranges are reused, the
+      // others are loaded from the page index
+      std::shared_ptr<RowGroupPageIndexReader> row_group_page_index;
+      bool page_index_loaded = false;
+      for (int column : column_indices) {
+        std::shared_ptr<OffsetIndex> offset_index = row_ranges[i].offset_index(column);
+        if (offset_index == nullptr) {
+          if (!page_index_loaded) {
+            if (page_index_reader == nullptr) {
+              page_index_reader = reader_->GetPageIndexReader();
+            }
+            if (page_index_reader != nullptr) {
+              row_group_page_index = page_index_reader->RowGroup(row_group);
+            }
+            page_index_loaded = true;
+          }
+          if (row_group_page_index != nullptr) {
+            offset_index = row_group_page_index->GetOffsetIndex(column);
+          }
+        }
+        selection->offset_indexes[{row_group, column}] = std::move(offset_index);
+      }
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    *row_groups = std::move(selected_row_groups);
+    if (selection->row_ranges.empty()) {
+      return nullptr;
+    }
+    return selection;
+  }
+
+  // The row groups to pre-buffer: those that are read in full, as only the pages of
+  // the others that hold selected rows are read.
+  std::vector<int> RowGroupsToPreBuffer(const std::vector<int>& row_groups,
+                                        const RowSelection* row_selection) const {
+    if (row_selection == nullptr) {
+      return row_groups;
+    }
+    std::vector<int> full_row_groups;
+    for (int row_group : row_groups) {
+      if (row_selection->RowsOf(row_group) == nullptr) {
+        full_row_groups.push_back(row_group);
+      }
+    }
+    return full_row_groups;
+  }
+
+  int64_t NumRowsToRead(int row_group, const RowSelection* row_selection) const {
+    const RowRanges* rows =
+        row_selection != nullptr ? row_selection->RowsOf(row_group) : nullptr;
+    return rows != nullptr ? rows->num_rows()
+                           : reader_->metadata()->RowGroup(row_group)->num_rows();
+  }
+
   Status GetColumn(int i, FileColumnIteratorFactory iterator_factory,
                    std::unique_ptr<ColumnReader>* out);
 
@@ -318,7 +412,9 @@ class FileReaderImpl : public FileReader {
   // alive in async contexts.
   Future<std::shared_ptr<Table>> DecodeRowGroups(
       std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
+      const std::vector<int>& column_indices,
+      std::shared_ptr<const RowSelection> row_selection,
+      ::arrow::internal::Executor* cpu_executor);
 
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
@@ -336,7 +432,13 @@ class FileReaderImpl : public FileReader {
 
   Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
       const std::vector<int>& row_group_indices,
-      const std::vector<int>& column_indices) override;
+      const std::vector<int>& column_indices) override {
+    return GetRecordBatchReader(row_group_indices, column_indices, {});
+  }
+
+  Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges) override;
 
   Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
       const std::vector<int>& row_group_indices) override {
@@ -354,6 +456,17 @@ class FileReaderImpl : public FileReader {
                           const std::vector<int> row_group_indices,
                           const std::vector<int> column_indices,
                           ::arrow::internal::Executor* cpu_executor,
+                          int64_t rows_to_readahead) override {
+    return GetRecordBatchGenerator(std::move(reader), row_group_indices, column_indices,
+                                   {}, cpu_executor, rows_to_readahead);
+  }
+
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          const std::vector<RowRanges>& row_ranges,
+                          ::arrow::internal::Executor* cpu_executor,
                           int64_t rows_to_readahead) override;
 
   int num_columns() const { return reader_->metadata()->num_columns(); }
@@ -495,29 +608,37 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->Reserve(records_to_read);
     const bool should_load_statistics = ctx_->reader_properties->should_load_statistics();
     int64_t num_target_row_groups = 0;
+    // Whether any row group read into this batch was only partially read, whose
+    // statistics then do not hold.  partial_row_group_ already describes the next row
+    // group once the last one has been read.
+    bool read_partial_row_group = false;
     while (records_to_read > 0) {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = ReadSelectedRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
       } else {
         num_target_row_groups++;
+        read_partial_row_group |= partial_row_group_;
         // We can't mix multiple row groups when we load statistics
         // because statistics are associated with a row group. If we
         // want to mix multiple row groups and keep valid statistics,
         // we need to implement a statistics merge logic.
-        if (should_load_statistics) {
+        // The statistics of a row group don't hold for some of its rows.
+        if (should_load_statistics && !partial_row_group_) {
           break;
         }
       }
     }
     RETURN_NOT_OK(TransferColumnData(
         record_reader_.get(),
-        num_target_row_groups == 1 ? input_->column_chunk_metadata() : nullptr, field_,
-        descr_, ctx_.get(), &out_));
+        num_target_row_groups == 1 && !read_partial_row_group
+            ? input_->column_chunk_metadata()
+            : nullptr,
+        field_, descr_, ctx_.get(), &out_));
     return Status::OK();
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -532,16 +653,101 @@ class LeafReader : public ColumnReaderImpl {
 
  private:
   std::shared_ptr<ChunkedArray> out_;
+
+  // Records to skip, then records to read, of a partially read row group
+  struct SelectionStep {
+    int64_t skip;
+    int64_t read;
+  };
+
   void NextRowGroup() {
-    std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+    const RowSelection* selection = ctx_->row_selection.get();
+    const int row_group = input_->next_row_group_index();
+    const RowRanges* rows =
+        selection != nullptr && row_group >= 0 ? selection->RowsOf(row_group) : nullptr;
+    schedule_.clear();
+    schedule_pos_ = 0;
+    partial_row_group_ = rows != nullptr;
+    if (rows == nullptr) {
+      record_reader_->SetPageReader(input_->NextChunk());
+      return;
+    }
+
+    // Only the pages overlapping the selected rows are read, if the column chunk
+    // has an offset index, so the steps are in the coordinates of the rows read.
+    const int64_t num_rows = ctx_->reader->metadata()->RowGroup(row_group)->num_rows();
+    const OffsetIndex* offset_index =
+        selection->OffsetIndexOf(row_group, input_->column_index());
+    RowRanges rows_read = RowRanges::All(num_rows);
+    std::unique_ptr<PageReader> page_reader;
+    if (offset_index != nullptr) {
+      std::vector<int32_t> pages = rows->OverlappingPages(*offset_index, num_rows);
+      rows_read = RowRanges::FromPages(*offset_index, num_rows, pages);
+      page_reader = input_->NextChunk(*offset_index, pages);
+    } else {
+      page_reader = input_->NextChunk();
+    }
+    auto read = rows_read.ranges().begin();
+    int64_t rows_before_read = 0;
+    int64_t position = 0;
+    for (const RowRanges::Range& range : rows->ranges()) {
+      while (read != rows_read.ranges().end() && read->end <= range.start) {
+        rows_before_read += read->length();
+        ++read;
+      }
+      if (read == rows_read.ranges().end() || range.start < read->start ||
+          range.end > read->end) {
+        throw ParquetException("Selected rows ", rows->ToString(), " of row group ",
+                               row_group, " are not in the pages read");
+      }
+      const int64_t start = rows_before_read + (range.start - read->start);
+      schedule_.push_back({start - position, range.length()});
+      position = start + range.length();
+    }
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Reads at most records_to_read of the selected records of the current row group,
+  // returning 0 once there are no more.
+  int64_t ReadSelectedRecords(int64_t records_to_read) {
+    if (!partial_row_group_) {
+      return record_reader_->ReadRecords(records_to_read);
+    }
+    while (schedule_pos_ < schedule_.size()) {
+      SelectionStep& step = schedule_[schedule_pos_];
+      if (step.skip > 0) {
+        const int64_t records_skipped = record_reader_->SkipRecords(step.skip);
+        if (records_skipped == 0) {
+          throw ParquetException("Column chunk of ", descr_->path()->ToDotString(),
+                                 " ended before the selected rows");
+        }
+        step.skip -= records_skipped;
+        continue;
+      }
+      const int64_t records_read =
+          record_reader_->ReadRecords(std::min(records_to_read, step.read));
+      if (records_read == 0) {
+        throw ParquetException("Column chunk of ", descr_->path()->ToDotString(),
+                               " ended before the selected rows");
+      }
+      step.read -= records_read;
+      if (step.read == 0) {
+        ++schedule_pos_;
+      }
+      return records_read;
+    }
+    return 0;
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+  // Whether only some rows of the current row group are read, as per schedule_
+  bool partial_row_group_ = false;
+  std::vector<SelectionStep> schedule_;
+  size_t schedule_pos_ = 0;
 };
 
 // Column reader for extension arrays
@@ -1003,20 +1209,27 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
 }  // namespace
 
 Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
-    const std::vector<int>& row_groups, const std::vector<int>& column_indices) {
-  RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+    const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+    const std::vector<RowRanges>& row_ranges) {
+  RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+
+  std::vector<int> row_groups = row_group_indices;
+  ARROW_ASSIGN_OR_RAISE(auto row_selection,
+                        MakeRowSelection(&row_groups, column_indices, row_ranges));
 
   if (reader_properties_.pre_buffer()) {
     // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    reader_->PreBuffer(row_groups, column_indices, reader_properties_.io_context(),
+    reader_->PreBuffer(RowGroupsToPreBuffer(row_groups, row_selection.get()),
+                       column_indices, reader_properties_.io_context(),
                        reader_properties_.cache_options());
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> batch_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, row_selection, &readers,
+                                &batch_schema));
 
   if (readers.empty()) {
     // Just generate all batches right now; they're cheap since they have no columns.
@@ -1027,7 +1240,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
     ::arrow::RecordBatchVector batches;
 
     for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+      int64_t num_rows = NumRowsToRead(row_group, row_selection.get());
 
       batches.insert(batches.end(), static_cast<size_t>(num_rows / batch_size),
                      max_sized_batch);
@@ -1043,7 +1256,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
 
   int64_t num_rows = 0;
   for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    num_rows += NumRowsToRead(row_group, row_selection.get());
   }
 
   using ::arrow::RecordBatchIterator;
@@ -1108,11 +1321,13 @@ class RowGroupGenerator {
   explicit RowGroupGenerator(std::shared_ptr<FileReaderImpl> arrow_reader,
                              ::arrow::internal::Executor* cpu_executor,
                              std::vector<int> row_groups, std::vector<int> column_indices,
+                             std::shared_ptr<const RowSelection> row_selection,
                              int64_t min_rows_in_flight)
       : arrow_reader_(std::move(arrow_reader)),
         cpu_executor_(cpu_executor),
         row_groups_(std::move(row_groups)),
         column_indices_(std::move(column_indices)),
+        row_selection_(std::move(row_selection)),
         min_rows_in_flight_(min_rows_in_flight),
         rows_in_flight_(0),
         index_(0),
@@ -1149,20 +1364,24 @@ class RowGroupGenerator {
     int row_group = row_groups_[row_group_index];
     std::vector<int> column_indices = column_indices_;
     auto reader = arrow_reader_;
-    int64_t num_rows =
-        reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    int64_t num_rows = reader->NumRowsToRead(row_group, row_selection_.get());
     rows_in_flight_ += num_rows;
     ::arrow::Future<RecordBatchGenerator> row_group_read;
-    if (!reader->properties().pre_buffer()) {
-      row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices);
+    // Partially read row groups are not pre-buffered
+    if (!reader->properties().pre_buffer() ||
+        (row_selection_ != nullptr && row_selection_->RowsOf(row_group) != nullptr)) {
+      row_group_read =
+          SubmitRead(cpu_executor_, reader, row_group, column_indices, row_selection_);
     } else {
       auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices);
       if (cpu_executor_) ready = cpu_executor_->TransferAlways(ready);
       row_group_read =
           ready.Then([cpu_executor = cpu_executor_, reader, row_group,
-                      column_indices = std::move(
-                          column_indices)]() -> ::arrow::Future<RecordBatchGenerator> {
-            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices);
+                      column_indices = std::move(column_indices),
+                      row_selection =
+                          row_selection_]() -> ::arrow::Future<RecordBatchGenerator> {
+            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices,
+                                   row_selection);
           });
     }
     in_flight_reads_.push({std::move(row_group_read), num_rows});
@@ -1175,21 +1394,26 @@ class RowGroupGenerator {
   // async I/O without forcing readahead.
   static ::arrow::Future<RecordBatchGenerator> SubmitRead(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const std::shared_ptr<const RowSelection>& row_selection) {
     if (!cpu_executor) {
-      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices);
+      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices,
+                             row_selection);
     }
     // If we have an executor, then force transfer (even if I/O was complete)
     return ::arrow::DeferNotOk(cpu_executor->Submit(ReadOneRowGroup, cpu_executor, self,
-                                                    row_group, column_indices));
+                                                    row_group, column_indices,
+                                                    row_selection));
   }
 
   static ::arrow::Future<RecordBatchGenerator> ReadOneRowGroup(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const std::shared_ptr<const RowSelection>& row_selection) {
     // Skips bound checks/pre-buffering, since we've done that already
     const int64_t batch_size = self->properties().batch_size();
-    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
+    return self
+        ->DecodeRowGroups(self, {row_group}, column_indices, row_selection, cpu_executor)
         .Then([batch_size](const std::shared_ptr<Table>& table)
                   -> ::arrow::Result<RecordBatchGenerator> {
           ::arrow::TableBatchReader table_reader(*table);
@@ -1203,6 +1427,7 @@ class RowGroupGenerator {
   ::arrow::internal::Executor* cpu_executor_;
   std::vector<int> row_groups_;
   std::vector<int> column_indices_;
+  std::shared_ptr<const RowSelection> row_selection_;
   int64_t min_rows_in_flight_;
   std::queue<ReadRequest> in_flight_reads_;
   int64_t rows_in_flight_;
@@ -1214,22 +1439,27 @@ class RowGroupGenerator {
 FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
                                         const std::vector<int> row_group_indices,
                                         const std::vector<int> column_indices,
+                                        const std::vector<RowRanges>& row_ranges,
                                         ::arrow::internal::Executor* cpu_executor,
                                         int64_t rows_to_readahead) {
   RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
   if (rows_to_readahead < 0) {
     return Status::Invalid("rows_to_readahead must be >= 0");
   }
+  std::vector<int> row_groups = row_group_indices;
+  ARROW_ASSIGN_OR_RAISE(auto row_selection,
+                        MakeRowSelection(&row_groups, column_indices, row_ranges));
   if (reader_properties_.pre_buffer()) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    reader_->PreBuffer(row_group_indices, column_indices, reader_properties_.io_context(),
+    reader_->PreBuffer(RowGroupsToPreBuffer(row_groups, row_selection.get()),
+                       column_indices, reader_properties_.io_context(),
                        reader_properties_.cache_options());
     END_PARQUET_CATCH_EXCEPTIONS
   }
   ::arrow::AsyncGenerator<RowGroupGenerator::RecordBatchGenerator> row_group_generator =
       RowGroupGenerator(::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader),
-                        cpu_executor, row_group_indices, column_indices,
-                        rows_to_readahead);
+                        cpu_executor, std::move(row_groups), column_indices,
+                        std::move(row_selection), rows_to_readahead);
   ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> concatenated =
       ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
   WRAP_ASYNC_GENERATOR(std::move(concatenated));
@@ -1266,19 +1496,22 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   }
 
   auto fut = DecodeRowGroups(/*self=*/nullptr, row_groups, column_indices,
-                             /*cpu_executor=*/nullptr);
+                             /*row_selection=*/nullptr, /*cpu_executor=*/nullptr);
   ARROW_ASSIGN_OR_RAISE(*out, fut.MoveResult());
   return Status::OK();
 }
 
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+    const std::vector<int>& column_indices,
+    std::shared_ptr<const RowSelection> row_selection,
+    ::arrow::internal::Executor* cpu_executor) {
   // `self` is used solely to keep `this` alive in an async context - but we use this
   // in a sync context too so use `this` over `self`
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, row_selection, &readers,
+                                &result_schema));
   // OptionalParallelForAsync requires an executor
   if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
 
@@ -1289,7 +1522,7 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     RETURN_NOT_OK(ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column));
     return column;
   };
-  auto make_table = [result_schema, row_groups, self,
+  auto make_table = [result_schema, row_groups, row_selection, self,
                      this](const ::arrow::ChunkedArrayVector& columns)
       -> ::arrow::Result<std::shared_ptr<Table>> {
     int64_t num_rows = 0;
@@ -1297,7 +1530,7 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
       num_rows = columns[0]->length();
     } else {
       for (int i : row_groups) {
-        num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
+        num_rows += NumRowsToRead(i, row_selection.get());
       }
     }
     auto table = Table::Make(std::move(result_schema), columns, num_rows);
@@ -26,6 +26,7 @@
 #include "parquet/file_reader.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
 
 namespace arrow {
 
@@ -192,6 +193,24 @@ class PARQUET_EXPORT FileReader {
   GetRecordBatchReader(const std::vector<int>& row_group_indices,
                        const std::vector<int>& column_indices) = 0;
 
+  /// \brief Return a RecordBatchReader of some rows of the row groups selected from
+  /// row_group_indices, whose columns are selected by column_indices.
+  ///
+  /// row_ranges[i] are the rows to read of row group row_group_indices[i], in that
+  /// row group's coordinates.  An empty row_ranges reads all rows.  For the column
+  /// chunks that have an offset index, only the data pages that overlap the
+  /// selected rows are read and decompressed; the other selected columns are read
+  /// in full and their unselected rows skipped, so that all columns stay aligned.
+  ///
+  /// \returns error Result if either row_group_indices or column_indices
+  ///     contains an invalid index, or if row_ranges does not match
+  ///     row_group_indices
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Result<std::unique_ptr<::arrow::RecordBatchReader>>
+  GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                       const std::vector<int>& column_indices,
+                       const std::vector<RowRanges>& row_ranges) = 0;
+
   /// \brief Return a RecordBatchReader of row groups selected from
   /// row_group_indices, whose columns are selected by column_indices.
   ///
@@ -234,6 +253,20 @@ class PARQUET_EXPORT FileReader {
                           ::arrow::internal::Executor* cpu_executor = NULLPTR,
                           int64_t rows_to_readahead = 0) = 0;
 
+  /// \brief Return a generator of record batches of some rows of the row groups
+  ///
+  /// row_ranges are as in GetRecordBatchReader(); an empty row_ranges reads all rows.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Result<
+      std::function<::arrow::Future<std::shared_ptr<::arrow::RecordBatch>>()>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          const std::vector<RowRanges>& row_ranges,
+                          ::arrow::internal::Executor* cpu_executor = NULLPTR,
+                          int64_t rows_to_readahead = 0) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
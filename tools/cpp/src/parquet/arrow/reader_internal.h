@@ -21,7 +21,9 @@
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <map>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -30,7 +32,9 @@
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
+#include "parquet/row_ranges.h"
 #include "parquet/schema.h"
 
 namespace arrow {
@@ -82,6 +86,24 @@ class FileColumnIterator {
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
+  /// \brief Like NextChunk(), but only reads the given data pages of the chunk
+  std::unique_ptr<::parquet::PageReader> NextChunk(const OffsetIndex& offset_index,
+                                                   const std::vector<int32_t>& pages) {
+    if (row_groups_.empty()) {
+      return nullptr;
+    }
+
+    row_group_index_ = row_groups_.front();
+    auto row_group_reader = reader_->RowGroup(row_group_index_);
+    row_groups_.pop_front();
+    return row_group_reader->GetColumnPageReader(column_index_, offset_index, pages);
+  }
+
+  /// \brief The row group that the next call to NextChunk() reads, or -1
+  int next_row_group_index() const {
+    return row_groups_.empty() ? -1 : row_groups_.front();
+  }
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -111,6 +133,25 @@ class FileColumnIterator {
 using FileColumnIteratorFactory =
     std::function<FileColumnIterator*(int, ParquetFileReader*)>;
 
+/// \brief The rows to read of the row groups that are not read in full
+struct RowSelection {
+  std::unordered_map<int, RowRanges> row_ranges;
+  /// The offset indexes of the column chunks of those row groups, by row group and
+  /// column index.  Null if the column chunk has no offset index.
+  std::map<std::pair<int, int>, std::shared_ptr<OffsetIndex>> offset_indexes;
+
+  /// \brief The rows to read of a row group, or null to read all of them
+  const RowRanges* RowsOf(int row_group) const {
+    auto it = row_ranges.find(row_group);
+    return it == row_ranges.end() ? nullptr : &it->second;
+  }
+
+  const OffsetIndex* OffsetIndexOf(int row_group, int column) const {
+    auto it = offset_indexes.find({row_group, column});
+    return it == offset_indexes.end() ? nullptr : it->second.get();
+  }
+};
+
 struct ReaderContext {
   ParquetFileReader* reader;
   ::arrow::MemoryPool* pool;
@@ -118,6 +159,8 @@ struct ReaderContext {
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
   ArrowReaderProperties* reader_properties;
+  /// Null if all rows of the row groups are read
+  std::shared_ptr<const RowSelection> row_selection;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/bloom_filter_builder.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
+
+namespace parquet {
+
+namespace {
+
+class BloomFilterBuilderImpl final : public BloomFilterBuilder {
+ public:
+  BloomFilterBuilderImpl(const SchemaDescriptor* schema,
+                         const WriterProperties* properties)
+      : schema_(schema), properties_(properties) {}
+
+  void AppendRowGroup() override {
+    if (finished_) {
+      throw ParquetException(
+          "Cannot call AppendRowGroup() to finished BloomFilterBuilder.");
+    }
+    bloom_filters_.emplace_back();
+  }
+
+  BloomFilter* GetOrCreateBloomFilter(int32_t i) override {
+    if (finished_) {
+      throw ParquetException("BloomFilterBuilder is already finished.");
+    }
+    if (i < 0 || i >= schema_->num_columns()) {
+      throw ParquetException("Invalid column ordinal: ", i);
+    }
+    if (bloom_filters_.empty()) {
+      throw ParquetException("No row group appended to BloomFilterBuilder.");
+    }
+    const ColumnDescriptor* descr = schema_->Column(i);
+    const auto& options = properties_->bloom_filter_options(descr->path());
+    if (!options.has_value() || descr->physical_type() == Type::BOOLEAN) {
+      return nullptr;
+    }
+    std::unique_ptr<BlockSplitBloomFilter>& bloom_filter = bloom_filters_.back()[i];
+    if (bloom_filter == nullptr) {
+      bloom_filter =
+          std::make_unique<BlockSplitBloomFilter>(properties_->memory_pool());
+      bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBytes(
+          static_cast<uint32_t>(options->ndv), options->fpp));
+    }
+    return bloom_filter.get();
+  }
+
+  void WriteTo(::arrow::io::OutputStream* sink, BloomFilterLocation* location) override {
+    if (finished_) {
+      throw ParquetException("BloomFilterBuilder is already finished.");
+    }
+    finished_ = true;
+    location->bloom_filter_location.clear();
+
+    // Serialize the Bloom filters ordered by row group ordinal and then column ordinal
+    for (size_t row_group = 0; row_group < bloom_filters_.size(); ++row_group) {
+      const auto& row_group_bloom_filters = bloom_filters_[row_group];
+      if (row_group_bloom_filters.empty()) {
+        continue;
+      }
+      auto& row_group_location = location->bloom_filter_location[row_group];
+      row_group_location.resize(static_cast<size_t>(schema_->num_columns()));
+      for (const auto& [column, bloom_filter] : row_group_bloom_filters) {
+        PARQUET_ASSIGN_OR_THROW(int64_t start, sink->Tell());
+        bloom_filter->WriteTo(sink);
+        PARQUET_ASSIGN_OR_THROW(int64_t end, sink->Tell());
+        row_group_location[column] = {start, static_cast<int32_t>(end - start)};
+      }
+    }
+    // The bitsets are no longer needed
+    bloom_filters_.clear();
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  const WriterProperties* properties_;
+  // Bloom filters of each row group, by column ordinal
+  std::vector<std::map<int32_t, std::unique_ptr<BlockSplitBloomFilter>>> bloom_filters_;
+  bool finished_ = false;
+};
+
+}  // namespace
+
+std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
+    const SchemaDescriptor* schema, const WriterProperties* properties) {
+  return std::make_unique<BloomFilterBuilderImpl>(schema, properties);
+}
+
+}  // namespace parquet
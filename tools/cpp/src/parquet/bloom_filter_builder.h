@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/type_fwd.h"
+#include "parquet/platform.h"
+#include "parquet/type_fwd.h"
+
+namespace parquet {
+
+class BloomFilter;
+struct BloomFilterLocation;
+
+/// \brief Interface for collecting the Bloom filters of a Parquet file being written.
+///
+/// Bloom filters are created for the columns with BloomFilterOptions in the writer
+/// properties, and are written together after the last row group.
+class PARQUET_EXPORT BloomFilterBuilder {
+ public:
+  /// \brief API convenience to create a BloomFilterBuilder.
+  ///
+  /// `schema` and `properties` must outlive the builder.
+  static std::unique_ptr<BloomFilterBuilder> Make(const SchemaDescriptor* schema,
+                                                  const WriterProperties* properties);
+
+  virtual ~BloomFilterBuilder() = default;
+
+  /// \brief Start a new row group.
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief Get the Bloom filter of a column chunk of the current row group.
+  ///
+  /// \param[in] i column ordinal.
+  /// \return the Bloom filter, created on first call and owned by the builder, or
+  /// nullptr if no Bloom filter is written for the column.
+  virtual BloomFilter* GetOrCreateBloomFilter(int32_t i) = 0;
+
+  /// \brief Write all the Bloom filters to the sink, after which no more Bloom
+  /// filters can be added.
+  ///
+  /// \param[in,out] sink output stream to write the Bloom filters.
+  /// \param[out] location the location of the Bloom filters in the sink.
+  virtual void WriteTo(::arrow::io::OutputStream* sink,
+                       BloomFilterLocation* location) = 0;
+};
+
+}  // namespace parquet
@@ -445,6 +445,12 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     EncodedStatistics data_page_statistics;
     if (ShouldSkipPage(&data_page_statistics)) {
       PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+      // Skipped data pages still count towards the ordinal of the next data page,
+      // which is part of its AAD when the column is encrypted.
+      const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+      if (page_type == PageType::DATA_PAGE || page_type == PageType::DATA_PAGE_V2) {
+        ++page_ordinal_;
+      }
       continue;
     }
 
@@ -18,6 +18,7 @@
 #include "parquet/column_writer.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <map>
@@ -33,6 +34,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils_internal.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -45,6 +47,8 @@
 #include "arrow/util/rle_encoding_internal.h"
 #include "arrow/util/type_traits.h"
 #include "arrow/visit_array_inline.h"
+#include "arrow/visit_data_inline.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/chunker_internal.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -1280,9 +1284,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilter* bloom_filter = nullptr)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties),
+        bloom_filter_(bloom_filter) {
     current_encoder_ = MakeEncoder(ParquetType::type_num, encoding, use_dictionary,
                                    descr_, properties->memory_pool());
     // We have to dynamic_cast as some compilers don't want to static_cast
@@ -1634,6 +1640,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   std::shared_ptr<SizeStatistics> chunk_size_statistics_;
   std::shared_ptr<geospatial::GeoStatistics> chunk_geospatial_statistics_;
   bool pages_change_on_record_boundaries_;
+  // Not owned, null unless a Bloom filter is written for the column chunk
+  BloomFilter* bloom_filter_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1859,6 +1867,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(values, num_values);
+    }
 
     UpdateUnencodedDataBytes();
 
@@ -1895,6 +1906,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset,
                                      num_spaced_values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (num_values != num_spaced_values) {
+        ::arrow::internal::VisitSetBitRunsVoid(
+            valid_bits, valid_bits_offset, num_spaced_values,
+            [&](int64_t position, int64_t length) {
+              UpdateBloomFilter(values + position, length);
+            });
+      } else {
+        UpdateBloomFilter(values, num_values);
+      }
+    }
 
     UpdateUnencodedDataBytes();
 
@@ -1905,6 +1927,50 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
       }
     }
   }
+
+  // Insert the hashes of `num_values` non-null values into the Bloom filter
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    if constexpr (std::is_same_v<ParquetType, BooleanType>) {
+      // Bloom filters are not written for boolean columns
+      return;
+    } else {
+      constexpr int64_t kHashBatchSize = 256;
+      std::array<uint64_t, kHashBatchSize> hashes;
+      for (int64_t offset = 0; offset < num_values; offset += kHashBatchSize) {
+        const int batch_size =
+            static_cast<int>(std::min(kHashBatchSize, num_values - offset));
+        if constexpr (std::is_same_v<ParquetType, FLBAType>) {
+          bloom_filter_->Hashes(values + offset, descr_->type_length(), batch_size,
+                                hashes.data());
+        } else {
+          bloom_filter_->Hashes(values + offset, batch_size, hashes.data());
+        }
+        bloom_filter_->InsertHashes(hashes.data(), batch_size);
+      }
+    }
+  }
+
+  // Insert the hashes of the non-null values of a binary-like array into the Bloom
+  // filter
+  void UpdateBloomFilter(const ::arrow::Array& values) {
+    auto insert = [&](std::string_view value) {
+      const ByteArray byte_array(value);
+      bloom_filter_->InsertHash(bloom_filter_->Hash(&byte_array));
+    };
+    auto skip_null = [] {};
+    if (::arrow::is_binary_like(values.type_id())) {
+      ::arrow::VisitArraySpanInline<::arrow::BinaryType>(*values.data(), insert,
+                                                         skip_null);
+    } else if (::arrow::is_large_binary_like(values.type_id())) {
+      ::arrow::VisitArraySpanInline<::arrow::LargeBinaryType>(*values.data(), insert,
+                                                              skip_null);
+    } else if (::arrow::is_binary_view_like(values.type_id())) {
+      ::arrow::VisitArraySpanInline<::arrow::BinaryViewType>(*values.data(), insert,
+                                                             skip_null);
+    } else {
+      throw ParquetException("Only binary-like data can be hashed as BYTE_ARRAY");
+    }
+  }
 };
 
 template <typename ParquetType>
@@ -1935,13 +2001,14 @@ Status TypedColumnWriterImpl<ParquetType>::WriteArrowDictionary(
   };
 
   if (!IsDictionaryIndexEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. Dense values are also needed to
+    // hash them into the Bloom filter, if any
     return WriteDense();
   }
 
@@ -2470,6 +2537,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
       page_statistics_->IncrementNullCount(batch_size - non_null);
       page_statistics_->IncrementNumValues(non_null);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(*data_slice);
+    }
 
     UpdateUnencodedDataBytes();
 
@@ -2644,7 +2714,8 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilter* bloom_filter) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -2665,25 +2736,32 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
           metadata, std::move(pager), use_dictionary, encoding, properties);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     default:
       ParquetException::NYI("type reader not implemented");
   }
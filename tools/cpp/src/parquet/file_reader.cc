@@ -162,6 +162,41 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const std::vector<int32_t>& pages) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  const auto num_pages = static_cast<int32_t>(offset_index.page_locations().size());
+  for (size_t j = 0; j < pages.size(); ++j) {
+    if (pages[j] < 0 || pages[j] >= num_pages || (j > 0 && pages[j] <= pages[j - 1])) {
+      throw ParquetException("Selected pages must be increasing indices of the ",
+                             num_pages, " pages of the offset index");
+    }
+  }
+  return contents_->GetColumnPageReader(i, offset_index, pages);
+}
+
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetColumnPageReader(
+    int i, const OffsetIndex& offset_index, const std::vector<int32_t>& pages) {
+  std::unique_ptr<PageReader> page_reader = GetColumnPageReader(i);
+  std::vector<bool> selected(offset_index.page_locations().size(), false);
+  for (int32_t page : pages) {
+    selected[page] = true;
+  }
+  // The filter is called for every data page, in order
+  auto skip_page = [selected = std::move(selected),
+                    ordinal = size_t{0}](const DataPageStats&) mutable {
+    const size_t page = ordinal++;
+    return page >= selected.size() || !selected[page];
+  };
+  page_reader->set_data_page_filter(std::move(skip_page));
+  return page_reader;
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -285,6 +320,78 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             always_compressed, &ctx);
   }
 
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const OffsetIndex& offset_index,
+      const std::vector<int32_t>& pages) override {
+    const std::vector<PageLocation>& locations = offset_index.page_locations();
+    auto col = row_group_metadata_->ColumnChunk(i);
+    const bool prebuffered =
+        cached_source_ && prebuffered_column_chunks_bitmap_ != nullptr &&
+        ::arrow::bit_util::GetBit(prebuffered_column_chunks_bitmap_->data(), i);
+    // Pre-buffered chunks are already in memory, and encrypted pages must be read
+    // in order to track the page ordinals of their AADs.
+    if (prebuffered || col->crypto_metadata() != nullptr ||
+        pages.size() == locations.size()) {
+      return RowGroupReader::Contents::GetColumnPageReader(i, offset_index, pages);
+    }
+
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    const int64_t col_end = col_range.offset + col_range.length;
+
+    // The dictionary page, if any, precedes the first data page
+    std::vector<::arrow::io::ReadRange> page_ranges;
+    if (!locations.empty() && locations[0].offset > col_range.offset) {
+      page_ranges.push_back(
+          {col_range.offset, locations[0].offset - col_range.offset});
+    }
+    for (int32_t page : pages) {
+      const PageLocation& location = locations[page];
+      if (location.offset < col_range.offset || location.compressed_page_size < 0 ||
+          location.offset + location.compressed_page_size > col_end) {
+        throw ParquetException("Invalid page location in offset index (corrupt file?)");
+      }
+      page_ranges.push_back({location.offset, location.compressed_page_size});
+    }
+
+    // Read nearby pages together, as pre-buffering would
+    const auto cache_options = ::arrow::io::CacheOptions::Defaults();
+    PARQUET_ASSIGN_OR_THROW(
+        auto read_ranges,
+        ::arrow::io::internal::CoalesceReadRanges(page_ranges,
+                                                  cache_options.hole_size_limit,
+                                                  cache_options.range_size_limit));
+    std::vector<std::shared_ptr<Buffer>> read_buffers;
+    read_buffers.reserve(read_ranges.size());
+    for (const auto& range : read_ranges) {
+      PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(range.offset, range.length));
+      if (buffer->size() < range.length) {
+        throw ParquetException("Column chunk ", i, " of row group ", row_group_ordinal_,
+                               " is truncated (corrupt file?)");
+      }
+      read_buffers.push_back(std::move(buffer));
+    }
+    std::vector<std::shared_ptr<Buffer>> page_buffers;
+    page_buffers.reserve(page_ranges.size());
+    size_t j = 0;
+    for (const auto& range : page_ranges) {
+      while (!read_ranges[j].Contains(range)) {
+        ++j;
+      }
+      page_buffers.push_back(SliceBuffer(
+          read_buffers[j], range.offset - read_ranges[j].offset, range.length));
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, ::arrow::ConcatenateBuffers(
+                                             page_buffers, properties_.memory_pool()));
+    auto stream = std::make_shared<::arrow::io::BufferReader>(std::move(buffer));
+
+    // See GetColumnPageReader(int) above
+    bool always_compressed = file_metadata_->writer_version().VersionLt(
+        ApplicationVersion::PARQUET_CPP_10353_FIXED_VERSION());
+    return PageReader::Open(std::move(stream), col->num_values(), col->compression(),
+                            properties_, always_compressed);
+  }
+
  private:
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
@@ -32,6 +32,7 @@ namespace parquet {
 
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageIndexReader;
 class BloomFilterReader;
 class PageReader;
@@ -49,6 +50,10 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    // The default implementation reads the whole column chunk and skips the data
+    // pages that were not selected.
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const OffsetIndex& offset_index, const std::vector<int32_t>& pages);
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -95,6 +100,17 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Construct a PageReader that returns the dictionary page, if any, and only the
+  // given data pages of the indicated column chunk.
+  //
+  // `pages` are indices into `offset_index`, the offset index of the column chunk,
+  // in increasing order.  Only the byte ranges of those pages are read from the
+  // file when possible.
+  //
+  // \note API EXPERIMENTAL
+  std::unique_ptr<PageReader> GetColumnPageReader(int i, const OffsetIndex& offset_index,
+                                                  const std::vector<int32_t>& pages);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -835,6 +835,45 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   inline uint32_t size() const { return metadata_len_; }
+
+  int64_t EstimatedMemoryUsage() const {
+    // The thrift structs with their strings and vectors, and the schema, whose
+    // nodes and column descriptors take about as much again as the schema elements
+    int64_t usage = sizeof(FileMetaDataImpl) + sizeof(format::FileMetaData);
+    for (const format::SchemaElement& element : metadata_->schema) {
+      usage += 3 * (sizeof(format::SchemaElement) + element.name.size());
+    }
+    for (const format::RowGroup& row_group : metadata_->row_groups) {
+      usage += sizeof(format::RowGroup) +
+               row_group.sorting_columns.size() * sizeof(format::SortingColumn);
+      for (const format::ColumnChunk& column_chunk : row_group.columns) {
+        const format::ColumnMetaData& column = column_chunk.meta_data;
+        usage += sizeof(format::ColumnChunk) + column_chunk.file_path.size() +
+                 column_chunk.encrypted_column_metadata.size();
+        usage += column.encodings.size() * sizeof(format::Encoding::type) +
+                 column.encoding_stats.size() * sizeof(format::PageEncodingStats);
+        for (const std::string& name : column.path_in_schema) {
+          usage += sizeof(std::string) + name.size();
+        }
+        for (const format::KeyValue& key_value : column.key_value_metadata) {
+          usage += sizeof(format::KeyValue) + key_value.key.size() +
+                   key_value.value.size();
+        }
+        const format::Statistics& statistics = column.statistics;
+        usage += statistics.max.size() + statistics.min.size() +
+                 statistics.max_value.size() + statistics.min_value.size();
+        usage += (column.size_statistics.repetition_level_histogram.size() +
+                  column.size_statistics.definition_level_histogram.size()) *
+                 sizeof(int64_t);
+      }
+    }
+    // Key-value metadata is held both by the thrift struct and key_value_metadata_
+    for (const format::KeyValue& key_value : metadata_->key_value_metadata) {
+      usage += 2 * (sizeof(format::KeyValue) + key_value.key.size() +
+                    key_value.value.size());
+    }
+    return usage;
+  }
   inline int num_columns() const { return schema_.num_columns(); }
   inline int64_t num_rows() const { return metadata_->num_rows; }
   inline int num_row_groups() const {
@@ -1085,6 +1124,10 @@ bool FileMetaData::VerifySignature(const void* signature) {
 
 uint32_t FileMetaData::size() const { return impl_->size(); }
 
+int64_t FileMetaData::EstimatedMemoryUsage() const {
+  return impl_->EstimatedMemoryUsage();
+}
+
 int FileMetaData::num_columns() const { return impl_->num_columns(); }
 
 int64_t FileMetaData::num_rows() const { return impl_->num_rows(); }
@@ -2043,6 +2086,29 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     }
   }
 
+  void SetBloomFilterLocation(const BloomFilterLocation& location) {
+    for (const auto& [row_group_ordinal, row_group_location] :
+         location.bloom_filter_location) {
+      if (row_group_ordinal >= row_groups_.size()) {
+        throw ParquetException("Cannot find metadata for row group ordinal ",
+                               row_group_ordinal);
+      }
+      auto& row_group_metadata = row_groups_[row_group_ordinal];
+      for (size_t i = 0; i < row_group_location.size(); ++i) {
+        const auto& bloom_filter_location = row_group_location[i];
+        if (!bloom_filter_location.has_value()) {
+          continue;
+        }
+        if (i >= row_group_metadata.columns.size()) {
+          throw ParquetException("Cannot find metadata for column ordinal ", i);
+        }
+        auto& column_metadata = row_group_metadata.columns[i].meta_data;
+        column_metadata.__set_bloom_filter_offset(bloom_filter_location->offset);
+        column_metadata.__set_bloom_filter_length(bloom_filter_location->length);
+      }
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
     int64_t total_rows = 0;
@@ -2161,6 +2227,10 @@ void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location
   impl_->SetPageIndexLocation(location);
 }
 
+void FileMetaDataBuilder::SetBloomFilterLocation(const BloomFilterLocation& location) {
+  impl_->SetBloomFilterLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish(
     const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
   return impl_->Finish(key_value_metadata);
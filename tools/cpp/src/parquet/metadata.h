@@ -321,6 +321,11 @@ class PARQUET_EXPORT FileMetaData {
   /// \brief Size of the original thrift encoded metadata footer.
   uint32_t size() const;
 
+  /// \brief Estimate of the memory held by the decoded metadata, in bytes.
+  ///
+  /// This is usually several times size().
+  int64_t EstimatedMemoryUsage() const;
+
   /// \brief Indicate if all of the FileMetaData's RowGroups can be decompressed.
   ///
   /// This will return false if any of the RowGroup's page is compressed with a
@@ -520,6 +525,16 @@ struct PageIndexLocation {
   FileIndexLocation offset_index_location;
 };
 
+/// \brief Public struct for location to all Bloom filters in a parquet file.
+struct BloomFilterLocation {
+  /// Alias type of Bloom filter location of a row group. The location is located by
+  /// column ordinal. If the column does not have a Bloom filter, its value is set to
+  /// std::nullopt.
+  using RowGroupBloomFilterLocation = std::vector<std::optional<IndexLocation>>;
+  /// Row group Bloom filter locations which uses row group ordinal as the key.
+  std::map<size_t, RowGroupBloomFilterLocation> bloom_filter_location;
+};
+
 class PARQUET_EXPORT FileMetaDataBuilder {
  public:
   // API convenience to get a MetaData builder
@@ -534,6 +549,9 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // Update location to all page indexes in the parquet file
   void SetPageIndexLocation(const PageIndexLocation& location);
 
+  // Update location to all Bloom filters in the parquet file
+  void SetBloomFilterLocation(const BloomFilterLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata = NULLPTR);
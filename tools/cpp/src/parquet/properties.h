@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -169,6 +170,15 @@ static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = true;
 static constexpr SizeStatisticsLevel DEFAULT_SIZE_STATISTICS_LEVEL =
     SizeStatisticsLevel::PageAndColumnChunk;
 
+/// \brief Sizing of the Bloom filter written for each chunk of a column
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// Expected number of distinct values in a column chunk. The filter is sized for
+  /// this many values and gets more false positives when it holds more.
+  int32_t ndv = 1 << 20;
+  /// False positive probability of the filter for `ndv` distinct values, in (0, 1)
+  double fpp = 0.05;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -236,6 +246,18 @@ class PARQUET_EXPORT ColumnProperties {
 
   bool page_index_enabled() const { return page_index_enabled_; }
 
+  void set_bloom_filter_options(std::optional<BloomFilterOptions> options) {
+    if (options && (options->ndv <= 0 || !(options->fpp > 0.0 && options->fpp < 1.0))) {
+      throw ParquetException("Bloom filter ndv must be positive and fpp in (0, 1)");
+    }
+    bloom_filter_options_ = options;
+  }
+
+  /// \brief The sizing of the column's Bloom filters, or nullopt if none are written
+  const std::optional<BloomFilterOptions>& bloom_filter_options() const {
+    return bloom_filter_options_;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -244,6 +266,7 @@ class PARQUET_EXPORT ColumnProperties {
   size_t max_stats_size_;
   std::shared_ptr<CodecOptions> codec_options_;
   bool page_index_enabled_;
+  std::optional<BloomFilterOptions> bloom_filter_options_;
 };
 
 // EXPERIMENTAL: Options for content-defined chunking.
@@ -743,6 +766,35 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_write_page_index(path->ToDotString());
     }
 
+    /// Write a Bloom filter of each chunk of the column specified by `path`, sized by
+    /// `options`. Default disabled.
+    ///
+    /// Bloom filters let readers skip row groups which cannot hold a value that is
+    /// looked up by equality, where min/max statistics do not help (e.g. ids).
+    Builder* enable_bloom_filter(const std::string& path,
+                                 BloomFilterOptions options = {}) {
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    /// Write a Bloom filter of each chunk of the column specified by `path`, sized by
+    /// `options`. Default disabled.
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 BloomFilterOptions options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    /// Disable writing Bloom filters for column specified by `path`. Default disabled.
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_[path] = std::nullopt;
+      return this;
+    }
+
+    /// Disable writing Bloom filters for column specified by `path`. Default disabled.
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     /// \brief Set the level to write size statistics for all columns. Default is
     /// PageAndColumnChunk.
     ///
@@ -776,6 +828,8 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_statistics_enabled(item.second);
       for (const auto& item : page_index_enabled_)
         get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
@@ -815,6 +869,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
     std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, std::optional<BloomFilterOptions>>
+        bloom_filter_options_;
 
     bool content_defined_chunking_enabled_;
     CdcOptions content_defined_chunking_options_;
@@ -925,6 +981,23 @@ class PARQUET_EXPORT WriterProperties {
     return false;
   }
 
+  const std::optional<BloomFilterOptions>& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  bool bloom_filter_enabled() const {
+    if (default_column_properties_.bloom_filter_options()) {
+      return true;
+    }
+    for (const auto& item : column_properties_) {
+      if (item.second.bloom_filter_options()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
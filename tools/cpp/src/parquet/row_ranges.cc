@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/row_ranges.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/page_index.h"
+
+namespace parquet {
+
+namespace {
+
+// The rows [start, end) of page `i` of a column chunk
+RowRanges::Range PageRows(const std::vector<PageLocation>& locations, size_t i,
+                          int64_t num_rows) {
+  const int64_t end =
+      i + 1 < locations.size() ? locations[i + 1].first_row_index : num_rows;
+  return {locations[i].first_row_index, end};
+}
+
+}  // namespace
+
+RowRanges::RowRanges(std::vector<Range> ranges) {
+  auto is_empty = [](const Range& range) { return range.end <= range.start; };
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(), is_empty), ranges.end());
+  std::sort(ranges.begin(), ranges.end(), [](const Range& left, const Range& right) {
+    return left.start < right.start;
+  });
+  for (const Range& range : ranges) {
+    if (!ranges_.empty() && range.start <= ranges_.back().end) {
+      ranges_.back().end = std::max(ranges_.back().end, range.end);
+    } else {
+      ranges_.push_back(range);
+    }
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) { return RowRanges({{0, num_rows}}); }
+
+RowRanges RowRanges::Intersect(const RowRanges& left, const RowRanges& right) {
+  std::vector<Range> ranges;
+  auto l = left.ranges_.begin();
+  auto r = right.ranges_.begin();
+  while (l != left.ranges_.end() && r != right.ranges_.end()) {
+    const int64_t start = std::max(l->start, r->start);
+    const int64_t end = std::min(l->end, r->end);
+    if (start < end) {
+      ranges.push_back({start, end});
+    }
+    if (l->end < r->end) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  RowRanges result;
+  result.ranges_ = std::move(ranges);
+  return result;
+}
+
+RowRanges RowRanges::Union(const RowRanges& left, const RowRanges& right) {
+  std::vector<Range> ranges = left.ranges_;
+  ranges.insert(ranges.end(), right.ranges_.begin(), right.ranges_.end());
+  return RowRanges(std::move(ranges));
+}
+
+RowRanges RowRanges::FromPages(const OffsetIndex& offset_index, int64_t num_rows,
+                               const std::vector<int32_t>& pages) {
+  const auto& locations = offset_index.page_locations();
+  std::vector<Range> ranges;
+  ranges.reserve(pages.size());
+  for (int32_t page : pages) {
+    if (page < 0 || static_cast<size_t>(page) >= locations.size()) {
+      throw ParquetException("Page ", page, " is not in an offset index of ",
+                             locations.size(), " pages");
+    }
+    ranges.push_back(PageRows(locations, static_cast<size_t>(page), num_rows));
+  }
+  return RowRanges(std::move(ranges));
+}
+
+std::vector<int32_t> RowRanges::OverlappingPages(const OffsetIndex& offset_index,
+                                                 int64_t num_rows) const {
+  const auto& locations = offset_index.page_locations();
+  std::vector<int32_t> pages;
+  auto range = ranges_.begin();
+  for (size_t i = 0; i < locations.size() && range != ranges_.end(); ++i) {
+    const Range page = PageRows(locations, i, num_rows);
+    while (range != ranges_.end() && range->end <= page.start) {
+      ++range;
+    }
+    if (range != ranges_.end() && range->start < page.end) {
+      pages.push_back(static_cast<int32_t>(i));
+    }
+  }
+  return pages;
+}
+
+int64_t RowRanges::num_rows() const {
+  int64_t num_rows = 0;
+  for (const Range& range : ranges_) {
+    num_rows += range.length();
+  }
+  return num_rows;
+}
+
+bool RowRanges::IsWithin(int64_t num_rows) const {
+  return ranges_.empty() ||
+         (ranges_.front().start >= 0 && ranges_.back().end <= num_rows);
+}
+
+void RowRanges::SetOffsetIndex(int column, std::shared_ptr<OffsetIndex> offset_index) {
+  offset_indexes_[column] = std::move(offset_index);
+}
+
+std::shared_ptr<OffsetIndex> RowRanges::offset_index(int column) const {
+  auto it = offset_indexes_.find(column);
+  return it == offset_indexes_.end() ? nullptr : it->second;
+}
+
+std::string RowRanges::ToString() const {
+  std::stringstream ss;
+  ss << "[";
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (i > 0) ss << ", ";
+    ss << "[" << ranges_[i].start << ", " << ranges_[i].end << ")";
+  }
+  ss << "]";
+  return ss.str();
+}
+
+}  // namespace parquet
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class OffsetIndex;
+
+/// \brief A set of rows of a row group, as sorted and disjoint ranges.
+///
+/// Readers given RowRanges for a row group read only the data pages that overlap
+/// them (when the column chunks have an offset index), and skip the other rows of
+/// those pages while decoding.
+///
+/// RowRanges may also carry the offset indexes of some column chunks of the row
+/// group, when they were already loaded to compute the ranges, so that readers do
+/// not load them again.  They are not part of the set of rows: the ranges that
+/// Intersect and Union return carry none, and operator== ignores them.
+///
+/// \note API EXPERIMENTAL
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief The rows [start, end) of a row group
+  struct Range {
+    int64_t start;
+    int64_t end;
+
+    int64_t length() const { return end - start; }
+
+    bool operator==(const Range& other) const {
+      return start == other.start && end == other.end;
+    }
+  };
+
+  /// \brief No rows
+  RowRanges() = default;
+
+  /// \brief The rows in any of `ranges`, which may be unsorted, overlapping or empty
+  explicit RowRanges(std::vector<Range> ranges);
+
+  /// \brief All the rows of a row group of `num_rows` rows
+  static RowRanges All(int64_t num_rows);
+
+  /// \brief The rows in both `left` and `right`
+  static RowRanges Intersect(const RowRanges& left, const RowRanges& right);
+
+  /// \brief The rows in `left` or in `right`
+  static RowRanges Union(const RowRanges& left, const RowRanges& right);
+
+  /// \brief The rows of some data pages of a column chunk
+  ///
+  /// \param[in] offset_index the offset index of the column chunk
+  /// \param[in] num_rows the number of rows of the row group
+  /// \param[in] pages indices of the pages in the offset index, in increasing order
+  static RowRanges FromPages(const OffsetIndex& offset_index, int64_t num_rows,
+                             const std::vector<int32_t>& pages);
+
+  /// \brief The indices, in the offset index of a column chunk, of the data pages
+  /// that contain some of these rows
+  std::vector<int32_t> OverlappingPages(const OffsetIndex& offset_index,
+                                        int64_t num_rows) const;
+
+  /// \brief The sorted, disjoint and non-adjacent ranges of rows
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  /// \brief Number of rows in the ranges
+  int64_t num_rows() const;
+
+  bool empty() const { return ranges_.empty(); }
+
+  /// \brief Whether all rows are in [0, num_rows)
+  bool IsWithin(int64_t num_rows) const;
+
+  /// \brief Attach the offset index of the column chunk of column `column`
+  void SetOffsetIndex(int column, std::shared_ptr<OffsetIndex> offset_index);
+
+  /// \brief The attached offset index of column `column`, or null if there is none
+  std::shared_ptr<OffsetIndex> offset_index(int column) const;
+
+  /// \brief The attached offset indexes, by column index
+  const std::map<int, std::shared_ptr<OffsetIndex>>& offset_indexes() const {
+    return offset_indexes_;
+  }
+
+  bool operator==(const RowRanges& other) const { return ranges_ == other.ranges_; }
+
+  std::string ToString() const;
+
+ private:
+  std::vector<Range> ranges_;
+  std::map<int, std::shared_ptr<OffsetIndex>> offset_indexes_;
+};
+
+}  // namespace parquet